@@ -0,0 +1,110 @@
+/**
+ * Compare vitest bench results against the checked-in baseline and fail on
+ * regressions larger than the threshold.
+ *
+ * Usage:
+ *   npm run bench:check    - compare bench-results.json against the baseline
+ *   npm run bench:update   - rewrite the baseline from the latest results
+ */
+
+import { existsSync, readFileSync, writeFileSync } from 'fs'
+import { resolve } from 'path'
+
+const RESULTS_PATH = resolve('bench-results.json')
+const BASELINE_PATH = resolve('src/lib/parser/__tests__/bench/baseline.json')
+
+/** Benchmarks slower than baseline by more than this fraction fail the check */
+const REGRESSION_THRESHOLD = 0.1
+
+/**
+ * Flatten vitest's bench JSON into "group > name" -> ops/sec. Walks the
+ * structure generically so minor format changes between vitest versions
+ * don't break the comparison.
+ */
+function collectBenchmarks(node: unknown, prefix: string, out: Record<string, number>): void {
+  if (Array.isArray(node)) {
+    for (const item of node) collectBenchmarks(item, prefix, out)
+    return
+  }
+  if (typeof node !== 'object' || node === null) return
+
+  const record = node as Record<string, unknown>
+  if (typeof record.name === 'string' && typeof record.hz === 'number') {
+    out[prefix ? `${prefix} > ${record.name}` : record.name] = record.hz
+    return
+  }
+
+  const groupName = typeof record.fullName === 'string' ? record.fullName : prefix
+  for (const value of Object.values(record)) {
+    collectBenchmarks(value, groupName, out)
+  }
+}
+
+function loadBenchmarks(path: string): Record<string, number> {
+  const parsed: unknown = JSON.parse(readFileSync(path, 'utf8'))
+  // Baseline files are already flat name -> hz maps
+  if (
+    typeof parsed === 'object' &&
+    parsed !== null &&
+    Object.values(parsed).every(value => typeof value === 'number')
+  ) {
+    return parsed as Record<string, number>
+  }
+  const out: Record<string, number> = {}
+  collectBenchmarks(parsed, '', out)
+  return out
+}
+
+function main(): void {
+  if (!existsSync(RESULTS_PATH)) {
+    console.error(`No bench results found at ${RESULTS_PATH}; run "npm run bench" first`)
+    process.exit(1)
+  }
+  const results = loadBenchmarks(RESULTS_PATH)
+  if (Object.keys(results).length === 0) {
+    console.error('Bench results contained no benchmarks')
+    process.exit(1)
+  }
+
+  if (process.argv.includes('--update')) {
+    writeFileSync(BASELINE_PATH, `${JSON.stringify(results, null, 2)}\n`)
+    console.log(`Baseline updated with ${Object.keys(results).length} benchmarks`)
+    return
+  }
+
+  const baseline = existsSync(BASELINE_PATH) ? loadBenchmarks(BASELINE_PATH) : {}
+  if (Object.keys(baseline).length === 0) {
+    console.log('Baseline is empty; run "npm run bench:update" to record one')
+    return
+  }
+
+  const regressions: string[] = []
+  for (const [name, baseHz] of Object.entries(baseline)) {
+    const currentHz = results[name]
+    if (currentHz === undefined) {
+      console.warn(`Missing from results (renamed or removed?): ${name}`)
+      continue
+    }
+    const change = (currentHz - baseHz) / baseHz
+    const changeLabel = `${change >= 0 ? '+' : ''}${(change * 100).toFixed(1)}%`
+    console.log(`${name}: ${currentHz.toFixed(1)} ops/s (${changeLabel} vs baseline)`)
+    if (change < -REGRESSION_THRESHOLD) {
+      regressions.push(`${name} regressed ${changeLabel}`)
+    }
+  }
+
+  for (const name of Object.keys(results)) {
+    if (!(name in baseline)) {
+      console.log(`New benchmark (not in baseline): ${name}`)
+    }
+  }
+
+  if (regressions.length > 0) {
+    console.error(`\n${regressions.length} benchmark(s) regressed more than 10%:`)
+    for (const regression of regressions) console.error(`  ${regression}`)
+    process.exit(1)
+  }
+  console.log('\nAll benchmarks within threshold')
+}
+
+main()
@@ -0,0 +1,56 @@
+#!/usr/bin/env -S npx tsx
+
+/**
+ * Script to compile the JSON ID mapping tables into compact binary tables
+ * Reads every *_map.json under src/lib/parser/games/<game>/data/ and writes a
+ * sibling .bin file (typed-array columns over a shared string table) that can
+ * be loaded with BinaryMapping.load without runtime Map construction
+ */
+
+import fs from 'fs/promises'
+import path from 'path'
+import { fileURLToPath } from 'url'
+import { BinaryMapping } from '../src/lib/parser/core/BinaryMapping'
+
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = path.dirname(__filename)
+
+const GAMES_DIR = path.join(__dirname, '..', 'src', 'lib', 'parser', 'games')
+
+async function main() {
+  const games = (await fs.readdir(GAMES_DIR, { withFileTypes: true }))
+    .filter(entry => entry.isDirectory())
+    .map(entry => entry.name)
+
+  for (const game of games) {
+    const dataDir = path.join(GAMES_DIR, game, 'data')
+    let files: string[]
+    try {
+      files = (await fs.readdir(dataDir)).filter(name => name.endsWith('_map.json'))
+    } catch {
+      continue // Game without mapping data
+    }
+
+    for (const file of files) {
+      const jsonPath = path.join(dataDir, file)
+      const binPath = jsonPath.replace(/\.json$/, '.bin')
+
+      const mapData = JSON.parse(await fs.readFile(jsonPath, 'utf8')) as Record<string, unknown>
+      const encoded = BinaryMapping.fromJson(mapData).encode()
+      await fs.writeFile(binPath, encoded)
+
+      const jsonSize = (await fs.stat(jsonPath)).size
+      console.log(
+        `${game}/${file} -> ${path.basename(binPath)} ` +
+          `(${(jsonSize / 1024).toFixed(1)}KB JSON -> ${(encoded.length / 1024).toFixed(1)}KB binary)`
+      )
+    }
+  }
+
+  console.log('Binary mapping tables generated.')
+}
+
+main().catch(error => {
+  console.error('Failed to generate binary mappings:', error)
+  process.exit(1)
+})
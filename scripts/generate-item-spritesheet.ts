@@ -0,0 +1,123 @@
+/**
+ * Packs the common item sprites into a single spritesheet served from our
+ * origin, so the item comboboxes don't fan out hundreds of cross-origin
+ * requests on a cold cache. Downloads each icon from the PokeAPI sprites
+ * repo, composites them onto a fixed grid with sharp, and writes
+ * public/sprites/items/sheet.png plus a sheet.json manifest mapping item
+ * id_names to grid indices. Items that fail to download are simply left out
+ * of the manifest; the app falls back to the remote URL for those.
+ *
+ * Run with: npm run generate-item-sheet
+ */
+
+import sharp from 'sharp'
+import { readFileSync, mkdirSync, writeFileSync } from 'fs'
+import { join } from 'path'
+
+const TILE = 32
+const COLUMNS = 16
+const CONCURRENCY = 16
+
+const projectRoot = process.cwd()
+const outputDir = join(projectRoot, 'public', 'sprites', 'items')
+
+interface RawItem {
+  id: number | null
+  id_name: string
+}
+
+function collectItemIdNames(): string[] {
+  const mapFiles = [
+    join(projectRoot, 'src/lib/parser/games/vanilla/data/item_map.json'),
+    join(projectRoot, 'src/lib/parser/games/quetzal/data/item_map.json'),
+  ]
+  const idNames = new Set<string>()
+  for (const file of mapFiles) {
+    const mapData = JSON.parse(readFileSync(file, 'utf8')) as Record<string, RawItem>
+    for (const item of Object.values(mapData)) {
+      if (item && typeof item.id === 'number' && item.id_name) {
+        idNames.add(item.id_name)
+      }
+    }
+  }
+  // Deterministic sheet layout across runs
+  return [...idNames].sort()
+}
+
+async function fetchSprite(idName: string): Promise<Buffer | null> {
+  const url = `https://raw.githubusercontent.com/PokeAPI/sprites/master/sprites/items/${idName}.png`
+  try {
+    const response = await fetch(url)
+    if (!response.ok) return null
+    return Buffer.from(await response.arrayBuffer())
+  } catch {
+    return null
+  }
+}
+
+async function generateSheet() {
+  const idNames = collectItemIdNames()
+  console.log(`Fetching ${idNames.length} item sprites...`)
+
+  const sprites = new Map<string, Buffer>()
+  for (let i = 0; i < idNames.length; i += CONCURRENCY) {
+    const batch = idNames.slice(i, i + CONCURRENCY)
+    const results = await Promise.all(batch.map(fetchSprite))
+    batch.forEach((idName, j) => {
+      const buffer = results[j]
+      if (buffer) sprites.set(idName, buffer)
+    })
+  }
+  const missing = idNames.length - sprites.size
+  if (missing > 0) {
+    console.warn(`${missing} sprites could not be fetched and will use the remote fallback`)
+  }
+
+  // Pack fetched sprites onto the grid in sorted order
+  const packed = [...sprites.keys()]
+  const rows = Math.max(1, Math.ceil(packed.length / COLUMNS))
+
+  const composites = await Promise.all(
+    packed.map(async (idName, index) => ({
+      input: await sharp(sprites.get(idName))
+        .resize(TILE, TILE, {
+          fit: 'contain',
+          kernel: 'nearest',
+          background: { r: 0, g: 0, b: 0, alpha: 0 },
+        })
+        .png()
+        .toBuffer(),
+      left: (index % COLUMNS) * TILE,
+      top: Math.floor(index / COLUMNS) * TILE,
+    }))
+  )
+
+  mkdirSync(outputDir, { recursive: true })
+  await sharp({
+    create: {
+      width: COLUMNS * TILE,
+      height: rows * TILE,
+      channels: 4,
+      background: { r: 0, g: 0, b: 0, alpha: 0 },
+    },
+  })
+    .composite(composites)
+    .png()
+    .toFile(join(outputDir, 'sheet.png'))
+
+  const manifest = {
+    tile: TILE,
+    columns: COLUMNS,
+    rows,
+    image: '/sprites/items/sheet.png',
+    items: Object.fromEntries(packed.map((idName, index) => [idName, index])),
+  }
+  writeFileSync(join(outputDir, 'sheet.json'), JSON.stringify(manifest))
+
+  console.log(`Generated sheet.png (${COLUMNS * TILE}x${rows * TILE}, ${packed.length} items)`)
+  console.log('Generated sheet.json')
+}
+
+generateSheet()
+  .then(() => console.log('Item spritesheet generated successfully!'))
+  .catch(console.error)
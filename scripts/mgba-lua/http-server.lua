@@ -170,10 +170,11 @@ end
 
 --- Creates WebSocket frame.
 ---@param data string
+---@param opcode? number Frame opcode (defaults to 0x1 text; pass 0x2 for binary)
 ---@return string
-function HttpServer.createWebSocketFrame(data)
+function HttpServer.createWebSocketFrame(data, opcode)
     local len = #data
-    local frame = string.char(0x81) -- FIN + text frame
+    local frame = string.char(0x80 | (opcode or 0x1)) -- FIN + opcode
     
     if len < 126 then
         frame = frame .. string.char(len)
@@ -188,7 +189,7 @@ end
 
 --- Parses WebSocket frame.
 ---@param data string
----@return string?, number
+---@return string?, number, number?
 function HttpServer.parseWebSocketFrame(data)
     if #data < 2 then return nil, 0 end
     local b1, b2 = string.byte(data, 1, 2)
@@ -224,9 +225,9 @@ function HttpServer.parseWebSocketFrame(data)
             end
             payload = table.concat(unmasked)
         end
-        return payload, offset + len
+        return payload, offset + len, opcode
     end
-    return "", offset + len
+    return "", offset + len, opcode
 end
 
 --------------------------------------------------------------------------------
@@ -434,6 +435,10 @@ function HttpServer:_handle_websocket_upgrade(clientId, req)
             local frame = HttpServer.createWebSocketFrame(data)
             self.client:send(frame)
         end,
+        sendBinary = function(self, data)
+            local frame = HttpServer.createWebSocketFrame(data, 0x2)
+            self.client:send(frame)
+        end,
         close = function(self)
             local closeFrame = string.char(0x88, 0x00) -- Close frame
             self.client:send(closeFrame)
@@ -463,12 +468,12 @@ function HttpServer:_handle_websocket_data(clientId)
         return
     end
     
-    local message, consumed = HttpServer.parseWebSocketFrame(chunk)
+    local message, consumed, opcode = HttpServer.parseWebSocketFrame(chunk)
     if consumed == -1 then -- Close frame
         self:_cleanup_client(clientId)
         return
     elseif message and ws.onMessage then
-        ws.onMessage(message)
+        ws.onMessage(message, opcode)
     end
 end
 
@@ -598,6 +603,89 @@ end
 -- Handlers
 --------------------------------------------------------------------------------
 
+-- Binary framed memory protocol. Requests and responses share a 10-byte
+-- little-endian header: [opcode u8][requestId u8][address u32][length u32]
+-- followed by a raw byte payload. Intentionally a global so clients can
+-- probe support via eval at connect time.
+BINARY_PROTOCOL_VERSION = 1
+
+local BINARY_OP_READ = 0x01
+local BINARY_OP_WRITE = 0x02
+local BINARY_OP_READ_OK = 0x81
+local BINARY_OP_WRITE_OK = 0x82
+local BINARY_OP_ERROR = 0xFF
+
+--- Packs a 32-bit value as a little-endian string.
+---@param value number
+---@return string
+local function packU32(value)
+    return string.char(value & 0xFF, (value >> 8) & 0xFF, (value >> 16) & 0xFF, (value >> 24) & 0xFF)
+end
+
+--- Builds a binary response frame payload.
+---@param opcode number
+---@param requestId number
+---@param address number
+---@param length number
+---@param payload? string
+---@return string
+local function packBinaryResponse(opcode, requestId, address, length, payload)
+    return string.char(opcode, requestId) .. packU32(address) .. packU32(length) .. (payload or "")
+end
+
+--- Handles a binary framed read/write request.
+---@param ws WebSocket
+---@param message string
+local function handleBinaryRequest(ws, message)
+    if #message < 10 then
+        ws:sendBinary(packBinaryResponse(BINARY_OP_ERROR, 0, 0, 0, "Truncated binary request"))
+        return
+    end
+
+    local opcode, requestId = message:byte(1), message:byte(2)
+    local a1, a2, a3, a4 = message:byte(3, 6)
+    local l1, l2, l3, l4 = message:byte(7, 10)
+    local address = a1 | (a2 << 8) | (a3 << 16) | (a4 << 24)
+    local length = l1 | (l2 << 8) | (l3 << 16) | (l4 << 24)
+
+    local function respond_error(err)
+        ws:sendBinary(packBinaryResponse(BINARY_OP_ERROR, requestId, address, 0, tostring(err)))
+    end
+
+    if opcode == BINARY_OP_READ then
+        local ok, result = pcall(function()
+            local bytes = {}
+            for i = 0, length - 1 do
+                bytes[i + 1] = string.char(emu:read8(address + i))
+            end
+            return table.concat(bytes)
+        end)
+        if ok then
+            ws:sendBinary(packBinaryResponse(BINARY_OP_READ_OK, requestId, address, length, result))
+        else
+            respond_error(result)
+        end
+    elseif opcode == BINARY_OP_WRITE then
+        local payload = message:sub(11)
+        if #payload ~= length then
+            respond_error("Write payload length mismatch")
+            return
+        end
+        local ok, err = pcall(function()
+            for i = 1, length do
+                emu:write8(address + i - 1, payload:byte(i))
+            end
+        end)
+        if ok then
+            ws:sendBinary(packBinaryResponse(BINARY_OP_WRITE_OK, requestId, address, length))
+        else
+            respond_error(err)
+        end
+    else
+        respond_error("Unknown binary opcode: " .. opcode)
+    end
+end
+
 -- WebSocket handler function
 local function handleWebSocketConnection(ws)
     log("WebSocket connected: " .. ws.path)
@@ -676,7 +764,13 @@ local function handleWebSocketConnection(ws)
         end
     end
 
-    ws.onMessage = function(message)        
+    ws.onMessage = function(message, opcode)
+        -- Binary frames carry framed memory read/write requests
+        if opcode == 0x2 then
+            handleBinaryRequest(ws, message)
+            return
+        end
+
         log("WebSocket request: " .. tostring(message))
 
         -- Check if this is a watch command
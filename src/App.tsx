@@ -15,6 +15,7 @@ import { Toaster } from './components/ui/sonner'
 import {
   useAutoRestore,
   useHistorySync,
+  usePartyPrefetch,
   usePokemonData,
   useThemeSync,
   useUndoRedoShortcuts,
@@ -28,6 +29,8 @@ export const App: React.FC = () => {
   const defaultTitle = 'Pokemon Save Editor - Edit Pokemon Save Files Online'
 
   const parse = useSaveFileStore(s => s.parse)
+  const previewFromSnapshot = useSaveFileStore(s => s.previewFromSnapshot)
+  const clearPreview = useSaveFileStore(s => s.clearPreview)
   const error = useSaveFileStore(s => s.error)
   const hasFile = useSaveFileStore(s => s.hasFile)
   const lastParseFailed = useSaveFileStore(s => s.lastParseFailed)
@@ -39,10 +42,16 @@ export const App: React.FC = () => {
   const undo = useHistoryStore(s => s.undo)
   const redo = useHistoryStore(s => s.redo)
 
-  const attemptingRestore = useAutoRestore({ parse, suppressAutoRestore })
+  const attemptingRestore = useAutoRestore({
+    parse,
+    previewFromSnapshot,
+    clearPreview,
+    suppressAutoRestore,
+  })
   useThemeSync({ theme, hasFile, saveFileName, defaultTitle })
   useUndoRedoShortcuts({ undo, redo })
   useHistorySync()
+  usePartyPrefetch()
 
   const hasSaveData = hasFile && partyList.length > 0
   const shouldShowDropzone = !hasSaveData && !lastParseFailed && !attemptingRestore
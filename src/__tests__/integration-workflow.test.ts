@@ -138,8 +138,8 @@ describe('Pokemon Save Web - Integration Workflow', () => {
       const saveData = fs.readFileSync(testDataPath)
       const saveArray = new Uint8Array(saveData)
 
-      // Detect game config
-      const config = GameConfigRegistry.detectGameConfig(saveArray)
+      // Detect game config, importing the winner's module on demand
+      const config = await GameConfigRegistry.resolveConfig(saveArray)
 
       expect(config).toBeDefined()
       expect(config?.name).toBeDefined()
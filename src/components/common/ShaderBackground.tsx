@@ -1,11 +1,106 @@
 import { Canvas, useFrame } from '@react-three/fiber'
-import { memo, useEffect, useMemo, useState } from 'react'
+import { memo, useEffect, useMemo, useRef, useState } from 'react'
 import { ShaderMaterial } from 'three'
 
 import fragmentShader from '../../glsl/shader.glsl?raw'
+import type { ShaderWorkerMessage } from './shaderBackground.worker'
 
 const vertexShader = 'varying vec2 vUv;void main(){vUv=uv;gl_Position=vec4(position,1.0);}'
 
+// Adaptive quality levels: full while the main thread is idle, reduced while
+// long tasks (parsing, heavy reconciliation, slider drags) are being observed
+const FULL_QUALITY = { renderScale: 1, maxFps: 60 } as const
+const REDUCED_QUALITY = { renderScale: 0.5, maxFps: 30 } as const
+const QUALITY_RESTORE_DELAY_MS = 2000
+
+const supportsOffscreenWorker =
+  typeof Worker !== 'undefined' &&
+  typeof HTMLCanvasElement !== 'undefined' &&
+  'transferControlToOffscreen' in HTMLCanvasElement.prototype
+
+/**
+ * Preferred path: render in a dedicated worker on an OffscreenCanvas with its
+ * own rAF loop, so the wallpaper never costs the editor a frame. The main
+ * thread only forwards resize/visibility events and quality hints derived
+ * from the PerformanceObserver long-task feed.
+ */
+const OffscreenShader = memo(() => {
+  const containerRef = useRef<HTMLDivElement>(null)
+
+  useEffect(() => {
+    const container = containerRef.current
+    if (!container) return
+
+    // The canvas is created imperatively because transferControlToOffscreen
+    // is one-shot per element; a fresh element per effect run keeps remounts
+    // (e.g. StrictMode) safe
+    const canvas = document.createElement('canvas')
+    canvas.style.width = '100%'
+    canvas.style.height = '100%'
+    canvas.style.display = 'block'
+    container.appendChild(canvas)
+
+    const worker = new Worker(new URL('./shaderBackground.worker.ts', import.meta.url), {
+      type: 'module',
+    })
+    const post = (message: ShaderWorkerMessage, transfer?: Transferable[]) =>
+      worker.postMessage(message, transfer ?? [])
+    const dpr = () => Math.min(window.devicePixelRatio || 1, 2)
+
+    const offscreen = canvas.transferControlToOffscreen()
+    post(
+      { type: 'init', canvas: offscreen, width: window.innerWidth, height: window.innerHeight, dpr: dpr() },
+      [offscreen]
+    )
+
+    const handleResize = () =>
+      post({ type: 'resize', width: window.innerWidth, height: window.innerHeight, dpr: dpr() })
+    window.addEventListener('resize', handleResize)
+
+    // Occluded tabs stop rendering entirely instead of just being throttled
+    const handleVisibility = () =>
+      post({ type: 'visible', visible: document.visibilityState === 'visible' })
+    document.addEventListener('visibilitychange', handleVisibility)
+
+    // Drop quality as soon as a main-thread long task shows up and restore it
+    // once none have been seen for a while
+    let reduced = false
+    let restoreTimer: ReturnType<typeof setTimeout> | undefined
+    let observer: PerformanceObserver | undefined
+    try {
+      observer = new PerformanceObserver(() => {
+        if (!reduced) {
+          reduced = true
+          post({ type: 'quality', ...REDUCED_QUALITY })
+        }
+        clearTimeout(restoreTimer)
+        restoreTimer = setTimeout(() => {
+          reduced = false
+          post({ type: 'quality', ...FULL_QUALITY })
+        }, QUALITY_RESTORE_DELAY_MS)
+      })
+      observer.observe({ entryTypes: ['longtask'] })
+    } catch {
+      // Long task timing unsupported; stay at full quality
+    }
+
+    return () => {
+      window.removeEventListener('resize', handleResize)
+      document.removeEventListener('visibilitychange', handleVisibility)
+      observer?.disconnect()
+      clearTimeout(restoreTimer)
+      post({ type: 'dispose' })
+      worker.terminate()
+      canvas.remove()
+    }
+  }, [])
+
+  return <div ref={containerRef} className='h-full w-full' />
+})
+
+OffscreenShader.displayName = 'OffscreenShader'
+
+/** Fallback path for browsers without OffscreenCanvas: render on the main thread */
 const Scene = memo(() => {
   const { material, uniformsRef } = useMemo(() => {
     const uniforms = {
@@ -44,9 +139,13 @@ export const ShaderBackground = memo(({ inverted = false }: { inverted?: boolean
     <div
       className={`fixed inset-0 transition-opacity duration-500 pointer-events-none z-[-1] ${isLoaded ? 'opacity-100' : 'opacity-0'} ${inverted ? 'invert' : ''}`}
     >
-      <Canvas gl={{ antialias: false, powerPreference: 'high-performance' }}>
-        <Scene />
-      </Canvas>
+      {supportsOffscreenWorker ? (
+        <OffscreenShader />
+      ) : (
+        <Canvas gl={{ antialias: false, powerPreference: 'high-performance' }}>
+          <Scene />
+        </Canvas>
+      )}
     </div>
   )
 })
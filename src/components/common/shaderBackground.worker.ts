@@ -0,0 +1,210 @@
+/**
+ * Web Worker entry for background shader rendering
+ * Owns a transferred OffscreenCanvas and runs its own rAF loop so the
+ * wallpaper never competes with parsing or React reconciliation on the main
+ * thread. The main thread only sends resize, visibility and quality hints;
+ * the adaptive quality controller lives in ShaderBackground.
+ */
+
+import fragmentShader from '../../glsl/shader.glsl?raw'
+
+// Fullscreen triangle; vUv matches what the three.js material fed the shader
+const vertexShader =
+  'attribute vec2 position;varying vec2 vUv;void main(){vUv=position*0.5+0.5;gl_Position=vec4(position,0.0,1.0);}'
+
+export interface ShaderInitMessage {
+  type: 'init'
+  canvas: OffscreenCanvas
+  width: number
+  height: number
+  dpr: number
+}
+
+export interface ShaderResizeMessage {
+  type: 'resize'
+  width: number
+  height: number
+  dpr: number
+}
+
+/** Adaptive quality hint: fraction of native resolution and a frame cap */
+export interface ShaderQualityMessage {
+  type: 'quality'
+  renderScale: number
+  maxFps: number
+}
+
+export interface ShaderVisibilityMessage {
+  type: 'visible'
+  visible: boolean
+}
+
+export interface ShaderDisposeMessage {
+  type: 'dispose'
+}
+
+export type ShaderWorkerMessage =
+  | ShaderInitMessage
+  | ShaderResizeMessage
+  | ShaderQualityMessage
+  | ShaderVisibilityMessage
+  | ShaderDisposeMessage
+
+let canvas: OffscreenCanvas | null = null
+let gl: WebGLRenderingContext | null = null
+let timeLocation: WebGLUniformLocation | null = null
+let resolutionLocation: WebGLUniformLocation | null = null
+
+let cssWidth = 0
+let cssHeight = 0
+let dpr = 1
+let renderScale = 1
+let maxFps = 60
+let visible = true
+
+let rafId = 0
+let shaderTime = 0
+let lastFrameAt = 0
+let lastTickAt = 0
+
+function compileShader(context: WebGLRenderingContext, type: number, source: string): WebGLShader {
+  const shader = context.createShader(type)
+  if (!shader) throw new Error('Failed to create shader')
+  context.shaderSource(shader, source)
+  context.compileShader(shader)
+  if (!context.getShaderParameter(shader, context.COMPILE_STATUS)) {
+    const log = context.getShaderInfoLog(shader) ?? 'unknown error'
+    context.deleteShader(shader)
+    throw new Error(`Shader compile failed: ${log}`)
+  }
+  return shader
+}
+
+function initGl(context: WebGLRenderingContext): void {
+  const program = context.createProgram()
+  if (!program) throw new Error('Failed to create program')
+  context.attachShader(program, compileShader(context, context.VERTEX_SHADER, vertexShader))
+  context.attachShader(program, compileShader(context, context.FRAGMENT_SHADER, fragmentShader))
+  context.linkProgram(program)
+  if (!context.getProgramParameter(program, context.LINK_STATUS)) {
+    throw new Error(`Program link failed: ${context.getProgramInfoLog(program) ?? 'unknown error'}`)
+  }
+  context.useProgram(program)
+
+  const buffer = context.createBuffer()
+  context.bindBuffer(context.ARRAY_BUFFER, buffer)
+  context.bufferData(
+    context.ARRAY_BUFFER,
+    new Float32Array([-1, -1, 3, -1, -1, 3]),
+    context.STATIC_DRAW
+  )
+  const position = context.getAttribLocation(program, 'position')
+  context.enableVertexAttribArray(position)
+  context.vertexAttribPointer(position, 2, context.FLOAT, false, 0, 0)
+
+  timeLocation = context.getUniformLocation(program, 'time')
+  resolutionLocation = context.getUniformLocation(program, 'resolution')
+  context.clearColor(0, 0, 0, 0)
+}
+
+function applySize(): void {
+  if (!canvas || !gl) return
+  const width = Math.max(1, Math.floor(cssWidth * dpr * renderScale))
+  const height = Math.max(1, Math.floor(cssHeight * dpr * renderScale))
+  if (canvas.width !== width || canvas.height !== height) {
+    canvas.width = width
+    canvas.height = height
+  }
+  gl.viewport(0, 0, width, height)
+}
+
+function frame(now: number): void {
+  rafId = requestAnimationFrame(frame)
+  if (!gl || !canvas) return
+
+  // Frame cap: skip rAF ticks that arrive before the quality budget allows
+  const minInterval = 1000 / maxFps
+  if (now - lastFrameAt < minInterval - 1) return
+  lastFrameAt = now
+
+  // Advance animation by real elapsed time, clamped so the drift does not
+  // jump after an occluded stretch
+  shaderTime += Math.min(now - lastTickAt, 100) / 1000
+  lastTickAt = now
+
+  gl.clear(gl.COLOR_BUFFER_BIT)
+  gl.uniform1f(timeLocation, shaderTime)
+  gl.uniform2f(resolutionLocation, canvas.width, canvas.height)
+  gl.drawArrays(gl.TRIANGLES, 0, 3)
+}
+
+function startLoop(): void {
+  if (rafId) return
+  lastTickAt = performance.now()
+  rafId = requestAnimationFrame(frame)
+}
+
+function stopLoop(): void {
+  if (rafId) {
+    cancelAnimationFrame(rafId)
+    rafId = 0
+  }
+}
+
+// Typed view of the dedicated worker scope (the DOM lib types `self` as Window)
+const workerScope = self as unknown as {
+  addEventListener(
+    type: 'message',
+    listener: (event: MessageEvent<ShaderWorkerMessage>) => void
+  ): void
+}
+
+workerScope.addEventListener('message', event => {
+  const message = event.data
+  switch (message.type) {
+    case 'init': {
+      canvas = message.canvas
+      cssWidth = message.width
+      cssHeight = message.height
+      dpr = message.dpr
+      const context = canvas.getContext('webgl', {
+        alpha: true,
+        antialias: false,
+        premultipliedAlpha: true,
+        powerPreference: 'high-performance',
+      }) as WebGLRenderingContext | null
+      if (!context) return
+      gl = context
+      initGl(gl)
+      applySize()
+      startLoop()
+      break
+    }
+    case 'resize': {
+      cssWidth = message.width
+      cssHeight = message.height
+      dpr = message.dpr
+      applySize()
+      break
+    }
+    case 'quality': {
+      renderScale = message.renderScale
+      maxFps = message.maxFps
+      applySize()
+      break
+    }
+    case 'visible': {
+      visible = message.visible
+      if (visible) startLoop()
+      else stopLoop()
+      break
+    }
+    case 'dispose': {
+      stopLoop()
+      gl?.getExtension('WEBGL_lose_context')?.loseContext()
+      gl = null
+      canvas = null
+      break
+    }
+  }
+})
@@ -0,0 +1,68 @@
+import { useEffect, useState } from 'react'
+import { getItemSpriteUrl } from '@/lib/parser/core/utils'
+import {
+  getItemSheetStyle,
+  getLoadedItemSpriteSheet,
+  loadItemSpriteSheet,
+  type ItemSpriteSheet,
+} from '@/lib/itemSpriteSheet'
+import { cn } from '@/lib/utils'
+
+const FALLBACK_URL = '/pokemon_item_placeholder_32x32.png'
+
+function useItemSpriteSheet(): ItemSpriteSheet | null {
+  const [sheet, setSheet] = useState<ItemSpriteSheet | null>(getLoadedItemSpriteSheet)
+
+  useEffect(() => {
+    if (sheet) return
+    let active = true
+    void loadItemSpriteSheet().then(loaded => {
+      if (active && loaded) setSheet(loaded)
+    })
+    return () => {
+      active = false
+    }
+  }, [sheet])
+
+  return sheet
+}
+
+export interface ItemSpriteProps {
+  idName: string
+  className?: string
+}
+
+/**
+ * Item icon sliced from the packed same-origin spritesheet when it carries
+ * the item, falling back to the individual remote sprite (service-worker
+ * cached after first use) otherwise
+ */
+export function ItemSprite({ idName, className }: ItemSpriteProps) {
+  const sheet = useItemSpriteSheet()
+  const sheetStyle = sheet ? getItemSheetStyle(sheet, idName) : null
+
+  if (sheetStyle) {
+    return (
+      <span
+        role="img"
+        aria-hidden
+        className={cn('inline-block bg-no-repeat image-pixelate', className)}
+        style={sheetStyle}
+      />
+    )
+  }
+
+  return (
+    <img
+      src={getItemSpriteUrl(idName)}
+      alt=""
+      className={cn('image-pixelate', className)}
+      onError={e => {
+        const img = e.currentTarget
+        if (img.dataset.fallbackApplied === '1') return
+        img.dataset.fallbackApplied = '1'
+        img.src = FALLBACK_URL
+      }}
+    />
+  )
+}
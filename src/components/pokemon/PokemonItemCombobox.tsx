@@ -12,7 +12,7 @@ import {
 import { Popover, PopoverContent, PopoverTrigger } from '@/components/ui/popover'
 import itemMapData from '@/lib/parser/games/quetzal/data/item_map.json'
 import { cn } from '@/lib/utils'
-import { getItemSpriteUrl } from '@/lib/parser/core/utils'
+import { ItemSprite } from './ItemSprite'
 
 interface ItemEntry {
   id: number
@@ -80,8 +80,6 @@ export function PokemonItemCombobox({
     },
   }
 
-  const FALLBACK_URL = '/pokemon_item_placeholder_32x32.png'
-
   return (
     <Popover open={open} onOpenChange={setOpen}>
       <PopoverTrigger asChild>
@@ -174,17 +172,7 @@ export function PokemonItemCombobox({
                           isSelected ? 'opacity-100' : 'opacity-0'
                         )}
                       />
-                      <img
-                        src={getItemSpriteUrl(item.id_name)}
-                        alt=""
-                        className="w-5 h-5 image-pixelate"
-                        onError={e => {
-                          const img = e.currentTarget
-                          if (img.dataset.fallbackApplied === '1') return
-                          img.dataset.fallbackApplied = '1'
-                          img.src = FALLBACK_URL
-                        }}
-                      />
+                      <ItemSprite idName={item.id_name} className="w-5 h-5" />
                       <span className="font-sans font-normal leading-5">{item.name}</span>
                     </div>
                   </CommandItem>
@@ -1,10 +1,9 @@
 import { Reorder } from 'framer-motion'
-import { useCallback, useRef, useState } from 'react'
+import { memo, useCallback, useRef, useState } from 'react'
 import { PokemonStatus } from '@/components/pokemon/PokemonStatus'
 import { PokemonStatusPlaceholder } from '@/components/pokemon/PokemonStatusPlaceholder'
 import { QuetzalConfig } from '@/lib/parser/games/quetzal/config'
-import { usePokemonStore } from '@/stores'
-import type { UIPokemonData } from '@/types'
+import { useIsActivePokemon, usePartyPokemon, usePartySlotIds, usePokemonStore } from '@/stores'
 
 // Use Quetzal config for constants since that's what most users will be using
 const config = new QuetzalConfig()
@@ -14,69 +13,115 @@ interface PokemonPartyListProps {
   onPokemonHover?: (id: number) => void
 }
 
+interface PartySlotProps {
+  id: number
+  isRenaming: boolean
+  isDragging: boolean
+  constraintsRef: React.RefObject<HTMLDivElement | null>
+  onDragStart: (id: number) => void
+  onDragEnd: () => void
+  onPokemonHover?: (id: number) => void
+}
+
+/**
+ * A single party card with its own store subscriptions. Each slot only
+ * re-renders when its own pokemon reference or active state changes, so
+ * an EV slider drag touches one card instead of the whole list.
+ */
+const PartySlot = memo<PartySlotProps>(
+  ({ id, isRenaming, isDragging, constraintsRef, onDragStart, onDragEnd, onPokemonHover }) => {
+    const pokemon = usePartyPokemon(id)
+    const isActive = useIsActivePokemon(id)
+    const setActivePokemonId = usePokemonStore(s => s.setActivePokemonId)
+    if (!pokemon) return null
+
+    return (
+      <Reorder.Item
+        value={id}
+        dragConstraints={constraintsRef}
+        dragElastic={0.1}
+        drag={!isRenaming}
+        animate={isDragging ? { scale: 1.05 } : { scale: 1 }}
+        transition={{ type: 'spring', stiffness: 500, damping: 30 }}
+        onDragStart={() => onDragStart(id)}
+        onDragEnd={onDragEnd}
+        className="cursor-pointer group"
+      >
+        <div
+          onMouseDown={() => {
+            if (!isRenaming) setActivePokemonId(id)
+          }}
+          onMouseEnter={() => {
+            if (onPokemonHover) onPokemonHover(id)
+          }}
+        >
+          <PokemonStatus pokemon={pokemon} isActive={isActive} />
+        </div>
+      </Reorder.Item>
+    )
+  }
+)
+PartySlot.displayName = 'PartySlot'
+
 export const PokemonPartyList: React.FC<PokemonPartyListProps> = ({
   isRenaming,
   onPokemonHover,
 }) => {
-  const partyList = usePokemonStore(s => s.partyList)
-  const activePokemonId = usePokemonStore(s => s.activePokemonId)
-  const setActivePokemonId = usePokemonStore(s => s.setActivePokemonId)
+  // Subscribe to slot ids only; the list itself re-renders on membership or
+  // order changes, not on per-pokemon edits
+  const partyIds = usePartySlotIds()
   const setPartyList = usePokemonStore(s => s.setPartyList)
   const commitPartyReorder = usePokemonStore(s => s.commitPartyReorder)
-  const emptySlots = Array.from({ length: Math.max(0, config.maxPartySize - partyList.length) })
+  const emptySlots = Array.from({ length: Math.max(0, config.maxPartySize - partyIds.length) })
   const constraintsRef = useRef<HTMLDivElement>(null)
   const [draggingId, setDraggingId] = useState<number | null>(null)
   const preDragIdsRef = useRef<number[] | null>(null)
 
   const handleReorder = useCallback(
-    (newOrder: UIPokemonData[]) => {
+    (newIds: number[]) => {
       // Keep object identity and ids during drag for stability
+      const { partyList } = usePokemonStore.getState()
+      const byId = new Map(partyList.map(p => [p.id, p]))
+      const newOrder = newIds
+        .map(id => byId.get(id))
+        .filter((p): p is NonNullable<typeof p> => p !== undefined)
       setPartyList(newOrder)
     },
     [setPartyList]
   )
 
+  const handleDragStart = useCallback((id: number) => {
+    setDraggingId(id)
+    // Capture pre-drag UI ids in slot order for a correct undo snapshot
+    preDragIdsRef.current = usePokemonStore.getState().partyList.map(p => p.id)
+  }, [])
+
+  const handleDragEnd = useCallback(() => {
+    setDraggingId(null)
+    const ids = preDragIdsRef.current ?? undefined
+    commitPartyReorder(usePokemonStore.getState().partyList, ids)
+    preDragIdsRef.current = null
+  }, [commitPartyReorder])
+
   return (
     <div ref={constraintsRef} className="flex flex-col gap-4">
       <Reorder.Group
         axis="y"
-        values={partyList}
+        values={partyIds}
         onReorder={handleReorder}
         className="flex flex-col gap-4"
       >
-        {partyList.map(pokemon => (
-          <Reorder.Item
-            key={pokemon.id}
-            value={pokemon}
-            dragConstraints={constraintsRef}
-            dragElastic={0.1}
-            drag={!isRenaming}
-            animate={draggingId === pokemon.id ? { scale: 1.05 } : { scale: 1 }}
-            transition={{ type: 'spring', stiffness: 500, damping: 30 }}
-            onDragStart={() => {
-              setDraggingId(pokemon.id)
-              // Capture pre-drag UI ids in slot order for a correct undo snapshot
-              preDragIdsRef.current = usePokemonStore.getState().partyList.map(p => p.id)
-            }}
-            onDragEnd={() => {
-              setDraggingId(null)
-              const ids = preDragIdsRef.current ?? undefined
-              commitPartyReorder(usePokemonStore.getState().partyList, ids)
-              preDragIdsRef.current = null
-            }}
-            className="cursor-pointer group"
-          >
-            <div
-              onMouseDown={() => {
-                if (!isRenaming) setActivePokemonId(pokemon.id)
-              }}
-              onMouseEnter={() => {
-                if (onPokemonHover) onPokemonHover(pokemon.id)
-              }}
-            >
-              <PokemonStatus pokemon={pokemon} isActive={pokemon.id === activePokemonId} />
-            </div>
-          </Reorder.Item>
+        {partyIds.map(id => (
+          <PartySlot
+            key={id}
+            id={id}
+            isRenaming={isRenaming}
+            isDragging={draggingId === id}
+            constraintsRef={constraintsRef}
+            onDragStart={handleDragStart}
+            onDragEnd={handleDragEnd}
+            onPokemonHover={onPokemonHover}
+          />
         ))}
       </Reorder.Group>
       {emptySlots.map((_, index) => (
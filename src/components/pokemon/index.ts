@@ -1,3 +1,4 @@
+export { ItemSprite } from './ItemSprite'
 export { PokemonTraitsSection } from './PokemonTraitsSection'
 export { PokemonHeader } from './PokemonHeader'
 export { PokemonMoveButton } from './PokemonMoveButton'
@@ -1,4 +1,5 @@
 export { usePokemonData } from './usePokemonData'
+export { usePartyPrefetch } from './usePartyPrefetch'
 export { useActivePokemonLoading } from './useActivePokemonLoading'
 export { useActiveItemDetails } from './useActiveItemDetails'
 export { useMegaPreview } from './useMegaPreview'
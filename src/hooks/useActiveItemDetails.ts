@@ -1,12 +1,11 @@
 import { useQuery } from '@tanstack/react-query'
 import { usePokemonStore, useSaveFileStore } from '@/stores'
+import { fetchJsonCached } from '@/lib/pokeapiCache'
 import type { PokeAPI } from 'pokeapi-types/dist/index'
 import type { z } from 'zod'
 
 async function fetchAndValidate<T>(url: string, schema?: z.ZodType<T>): Promise<T> {
-  const response = await fetch(url)
-  if (!response.ok) throw new Error(`Failed to fetch from ${url}: ${response.statusText}`)
-  const data = await response.json()
+  const data = await fetchJsonCached<unknown>(url)
   if (!schema) return data as T
   const result = schema.safeParse(data)
   if (!result.success) throw new Error(`Invalid API response format for ${url}`)
@@ -5,10 +5,17 @@ import type { SaveFileStore } from '@/stores'
 
 interface UseAutoRestoreOptions {
   parse: SaveFileStore['parse']
+  previewFromSnapshot: SaveFileStore['previewFromSnapshot']
+  clearPreview: SaveFileStore['clearPreview']
   suppressAutoRestore: boolean
 }
 
-export function useAutoRestore({ parse, suppressAutoRestore }: UseAutoRestoreOptions) {
+export function useAutoRestore({
+  parse,
+  previewFromSnapshot,
+  clearPreview,
+  suppressAutoRestore,
+}: UseAutoRestoreOptions) {
   const [attemptingRestore, setAttemptingRestore] = useState(true)
   const triedRestore = useRef(false)
 
@@ -25,16 +32,30 @@ export function useAutoRestore({ parse, suppressAutoRestore }: UseAutoRestoreOpt
         if (!first) return
         const { handle } = first
 
+        // Paint the party from the persisted snapshot right away, before the
+        // permission prompt and re-parse; the real parse replaces it when done
+        if (first.snapshot) {
+          try {
+            await previewFromSnapshot(first.snapshot)
+          } catch {}
+        }
+
         if (hasFsPermissions(handle) && typeof handle.queryPermission === 'function') {
           let status = await handle.queryPermission({ mode: 'read' })
           if (status !== 'granted' && typeof handle.requestPermission === 'function') {
             try {
               status = await handle.requestPermission({ mode: 'read' })
             } catch {
+              clearPreview()
               return
             }
           }
-          if (status !== 'granted') return
+          if (status !== 'granted') {
+            // Without read access the snapshot can never be reconciled with
+            // the file, so fall back to the dropzone
+            clearPreview()
+            return
+          }
         }
 
         await parse(handle)
@@ -48,7 +69,7 @@ export function useAutoRestore({ parse, suppressAutoRestore }: UseAutoRestoreOpt
     return () => {
       cancelled = true
     }
-  }, [parse, suppressAutoRestore])
+  }, [parse, previewFromSnapshot, clearPreview, suppressAutoRestore])
 
   return attemptingRestore
 }
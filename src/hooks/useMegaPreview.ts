@@ -1,6 +1,7 @@
 import { useMemo } from 'react'
 import { useQuery } from '@tanstack/react-query'
 import { usePokemonStore, useSaveFileStore } from '@/stores'
+import { fetchJsonCached } from '@/lib/pokeapiCache'
 import type { z } from 'zod'
 import type { PokeAPI } from 'pokeapi-types/dist/index'
 import { PokemonTypeSchema, type PokemonType } from '@/types'
@@ -10,9 +11,7 @@ const formatName = (name: string): string =>
   name.replace(/-/g, ' ').replace(/\b\w/g, l => l.toUpperCase())
 
 async function fetchAndValidate<T>(url: string, schema?: z.ZodType<T>): Promise<T> {
-  const resp = await fetch(url)
-  if (!resp.ok) throw new Error(`Failed to fetch ${url}: ${resp.statusText}`)
-  const data = await resp.json()
+  const data = await fetchJsonCached<unknown>(url)
   if (!schema) return data as T
   const result = schema.safeParse(data)
   if (!result.success) throw new Error(`Invalid API response format for ${url}`)
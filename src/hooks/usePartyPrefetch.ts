@@ -0,0 +1,143 @@
+import { useQueryClient } from '@tanstack/react-query'
+import { useEffect, useRef } from 'react'
+import { getItemSpriteUrl } from '@/lib/parser/core/utils'
+import { usePokemonStore, useSaveFileStore } from '../stores'
+import type { UIPokemonData } from '../types'
+import { getPokemonDetails } from './usePokemonData'
+
+interface PrefetchTask {
+  /** UI id of the party member this task belongs to, for preemption */
+  pokemonId: number
+  run: () => Promise<unknown>
+}
+
+/**
+ * Small FIFO task queue with a concurrency cap and priority preemption:
+ * tasks for the active Pokemon can be pulled to the front at any time
+ */
+class PrefetchQueue {
+  private queue: PrefetchTask[] = []
+  private running = 0
+
+  constructor(private readonly concurrency = 2) {}
+
+  enqueue(task: PrefetchTask): void {
+    this.queue.push(task)
+    this.pump()
+  }
+
+  /** Move all queued tasks for the given Pokemon to the front */
+  prioritize(pokemonId: number): void {
+    const prioritized = this.queue.filter(t => t.pokemonId === pokemonId)
+    if (prioritized.length === 0) return
+    this.queue = [...prioritized, ...this.queue.filter(t => t.pokemonId !== pokemonId)]
+  }
+
+  clear(): void {
+    this.queue = []
+  }
+
+  private pump(): void {
+    while (this.running < this.concurrency && this.queue.length > 0) {
+      const task = this.queue.shift()!
+      this.running++
+      task
+        .run()
+        .catch(() => {
+          // Prefetching is best-effort; real fetches surface their own errors
+        })
+        .finally(() => {
+          this.running--
+          this.pump()
+        })
+    }
+  }
+}
+
+/**
+ * Warm the browser image cache for a URL without blocking on failures
+ */
+function warmImage(url: string): Promise<void> {
+  return new Promise(resolve => {
+    if (typeof Image === 'undefined') {
+      resolve()
+      return
+    }
+    const img = new Image()
+    img.addEventListener('load', () => resolve())
+    img.addEventListener('error', () => resolve())
+    img.src = url
+  })
+}
+
+function warmSprites(pokemon: UIPokemonData): Promise<void> {
+  const urls = [pokemon.spriteUrl, pokemon.spriteAniUrl]
+  const { itemIdName } = pokemon.data
+  if (itemIdName) {
+    urls.push(getItemSpriteUrl(itemIdName))
+  }
+  return Promise.all(urls.map(warmImage)).then(() => undefined)
+}
+
+/**
+ * Background prefetch pipeline: once a save is parsed, walks the full party
+ * and warms the detail query cache and sprite URLs with a small concurrency
+ * limit, so clicking through the party doesn't incur a network waterfall.
+ * The active Pokemon's tasks always run first and are re-prioritized when
+ * the selection changes.
+ */
+export function usePartyPrefetch() {
+  const queryClient = useQueryClient()
+  const partyList = usePokemonStore(s => s.partyList)
+  const activePokemonId = usePokemonStore(s => s.activePokemonId)
+  const saveSessionId = useSaveFileStore(s => s.saveSessionId)
+
+  const queueRef = useRef<PrefetchQueue | null>(null)
+  queueRef.current ??= new PrefetchQueue()
+
+  // Rebuild the pipeline whenever a new party (or save session) appears
+  useEffect(() => {
+    const queue = queueRef.current!
+    queue.clear()
+    if (partyList.length === 0) return
+
+    // Active Pokemon first, then party order
+    const ordered = [...partyList].sort((a, b) => {
+      if (a.id === activePokemonId) return -1
+      if (b.id === activePokemonId) return 1
+      return 0
+    })
+
+    for (const pokemon of ordered) {
+      queue.enqueue({
+        pokemonId: pokemon.id,
+        run: () =>
+          queryClient.prefetchQuery({
+            queryKey: [
+              'pokemon',
+              'details',
+              saveSessionId,
+              pokemon.data.speciesId,
+              String(pokemon.id),
+            ],
+            queryFn: () => getPokemonDetails(pokemon),
+            staleTime: 1000 * 60 * 60,
+          }),
+      })
+      queue.enqueue({
+        pokemonId: pokemon.id,
+        run: () => warmSprites(pokemon),
+      })
+    }
+    // activePokemonId is deliberately not a dependency: selection changes are
+    // handled by preemption below instead of rebuilding the whole pipeline
+    // eslint-disable-next-line react-hooks/exhaustive-deps
+  }, [partyList, saveSessionId, queryClient])
+
+  // Pull the newly selected Pokemon's remaining tasks to the front
+  useEffect(() => {
+    if (activePokemonId >= 0) {
+      queueRef.current!.prioritize(activePokemonId)
+    }
+  }, [activePokemonId])
+}
@@ -1,6 +1,7 @@
 import { useQuery, useQueryClient } from '@tanstack/react-query'
 import type { PokeAPI } from 'pokeapi-types/dist/index'
 import { useCallback, useEffect } from 'react'
+import { fetchJsonCached } from '../lib/pokeapiCache'
 import { buildPartyListFromSaveData, usePokemonStore, useSaveFileStore } from '../stores'
 import {
   type MoveWithDetails,
@@ -31,11 +32,10 @@ const parsePokemonType = (apiType: string): PokemonType => {
   return result.success ? result.data : UNKNOWN_TYPE
 }
 
-// Lightweight fetch helper: rely on PokeAPI TypeScript types + targeted guards
+// Lightweight fetch helper: rely on PokeAPI TypeScript types + targeted guards.
+// Served through the persistent IndexedDB cache so prefetches hit disk first.
 async function fetchJson<T>(url: string): Promise<T> {
-  const response = await fetch(url)
-  if (!response.ok) throw new Error(`Failed to fetch from ${url}: ${response.statusText}`)
-  return (await response.json()) as T
+  return fetchJsonCached<T>(url)
 }
 
 // Pick best English effect text if present
@@ -0,0 +1,32 @@
+import { describe, expect, it } from 'vitest'
+import { getItemSheetStyle, type ItemSpriteSheet } from '@/lib/itemSpriteSheet'
+
+const sheet: ItemSpriteSheet = {
+  tile: 32,
+  columns: 4,
+  rows: 3,
+  image: '/sprites/items/sheet.png',
+  items: { 'poke-ball': 0, potion: 5, 'master-ball': 11 },
+}
+
+describe('getItemSheetStyle', () => {
+  it('slices the first tile at the top-left corner', () => {
+    expect(getItemSheetStyle(sheet, 'poke-ball')).toEqual({
+      backgroundImage: 'url(/sprites/items/sheet.png)',
+      backgroundSize: '400% 300%',
+      backgroundPosition: '0% 0%',
+    })
+  })
+
+  it('steps exactly one tile per grid index', () => {
+    // Index 5 = column 1, row 1 of a 4x3 grid
+    const style = getItemSheetStyle(sheet, 'potion')
+    expect(style?.backgroundPosition).toBe(`${(1 / 3) * 100}% 50%`)
+    // Last tile lands on the bottom-right corner
+    expect(getItemSheetStyle(sheet, 'master-ball')?.backgroundPosition).toBe('100% 100%')
+  })
+
+  it('returns null for items the sheet does not carry', () => {
+    expect(getItemSheetStyle(sheet, 'berry-pouch')).toBeNull()
+  })
+})
@@ -0,0 +1,36 @@
+/**
+ * Tests for the persistent PokeAPI cache
+ * The Node test environment has no IndexedDB, which exercises the fallback path
+ */
+
+import { afterEach, describe, expect, it, vi } from 'vitest'
+import { fetchJsonCached } from '../pokeapiCache'
+
+describe('fetchJsonCached', () => {
+  afterEach(() => {
+    vi.unstubAllGlobals()
+  })
+
+  it('should fall back to plain fetch when IndexedDB is unavailable', async () => {
+    const fetchMock = vi.fn().mockResolvedValue({
+      ok: true,
+      text: () => Promise.resolve(JSON.stringify({ name: 'treecko' })),
+    })
+    vi.stubGlobal('fetch', fetchMock)
+
+    const result = await fetchJsonCached<{ name: string }>('https://pokeapi.co/api/v2/pokemon/252')
+    expect(result.name).toBe('treecko')
+    expect(fetchMock).toHaveBeenCalledOnce()
+  })
+
+  it('should surface HTTP errors with the failing URL', async () => {
+    vi.stubGlobal(
+      'fetch',
+      vi.fn().mockResolvedValue({ ok: false, statusText: 'Not Found' })
+    )
+
+    await expect(fetchJsonCached('https://pokeapi.co/api/v2/pokemon/0')).rejects.toThrow(
+      'Failed to fetch from https://pokeapi.co/api/v2/pokemon/0: Not Found'
+    )
+  })
+})
@@ -0,0 +1,68 @@
+/**
+ * Runtime side of the packed item spritesheet
+ * (generated by scripts/generate-item-spritesheet.ts)
+ *
+ * The manifest is fetched once per session and shared by every icon; items
+ * missing from the sheet (or the whole sheet, when it was never generated)
+ * fall back to the individual remote sprite URLs, which the service worker
+ * caches after first use.
+ */
+
+export interface ItemSpriteSheet {
+  /** Square tile edge in sheet pixels */
+  tile: number
+  columns: number
+  rows: number
+  /** Same-origin URL of the sheet image */
+  image: string
+  /** Grid index per item id_name */
+  items: Record<string, number>
+}
+
+const SHEET_MANIFEST_URL = '/sprites/items/sheet.json'
+
+let sheetPromise: Promise<ItemSpriteSheet | null> | null = null
+let loadedSheet: ItemSpriteSheet | null = null
+
+/**
+ * Fetch the sheet manifest, memoized for the session. Resolves null when the
+ * sheet has not been generated or the fetch fails.
+ */
+export function loadItemSpriteSheet(): Promise<ItemSpriteSheet | null> {
+  sheetPromise ??= fetch(SHEET_MANIFEST_URL)
+    .then(response => (response.ok ? (response.json() as Promise<ItemSpriteSheet>) : null))
+    .then(sheet => {
+      loadedSheet = sheet
+      return sheet
+    })
+    .catch(() => null)
+  return sheetPromise
+}
+
+/** Synchronous access to the manifest once a load has completed */
+export function getLoadedItemSpriteSheet(): ItemSpriteSheet | null {
+  return loadedSheet
+}
+
+/**
+ * CSS background properties slicing one tile out of the sheet, sized to the
+ * rendering element. Returns null for items the sheet does not carry.
+ */
+export function getItemSheetStyle(
+  sheet: ItemSpriteSheet,
+  idName: string
+): { backgroundImage: string; backgroundSize: string; backgroundPosition: string } | null {
+  const index = sheet.items[idName]
+  if (index === undefined) return null
+  const column = index % sheet.columns
+  const row = Math.floor(index / sheet.columns)
+  // Percentage positioning: with the image sized to columns x rows tiles,
+  // n/(count-1) steps the background exactly one tile at a time
+  const x = sheet.columns > 1 ? (column / (sheet.columns - 1)) * 100 : 0
+  const y = sheet.rows > 1 ? (row / (sheet.rows - 1)) * 100 : 0
+  return {
+    backgroundImage: `url(${sheet.image})`,
+    backgroundSize: `${sheet.columns * 100}% ${sheet.rows * 100}%`,
+    backgroundPosition: `${x}% ${y}%`,
+  }
+}
@@ -108,6 +108,214 @@ describe('MgbaWebSocketClient - Memory Watching API', () => {
     })
   })
 
+  describe('Binary Protocol', () => {
+    type ClientInternals = {
+      connected: boolean
+      ws: { send: (data: Uint8Array) => void }
+      binaryProtocolVersion: number
+      handleBinaryMessage: (frame: Uint8Array) => void
+    }
+
+    const enableBinary = (sentFrames: Uint8Array[]) => {
+      const internals = client as unknown as ClientInternals
+      internals.connected = true
+      internals.ws = { send: frame => sentFrames.push(frame) }
+      internals.binaryProtocolVersion = 1
+      return internals
+    }
+
+    it('should not report binary support before negotiation', () => {
+      expect(client.supportsBinaryProtocol()).toBe(false)
+    })
+
+    it('should frame read requests with opcode, address and length', async () => {
+      const sentFrames: Uint8Array[] = []
+      const internals = enableBinary(sentFrames)
+
+      const pendingRead = client.readBytes(0x20244ec, 4)
+      expect(sentFrames).toHaveLength(1)
+
+      const request = sentFrames[0]!
+      const view = new DataView(request.buffer)
+      expect(view.getUint8(0)).toBe(0x01) // READ opcode
+      expect(view.getUint32(2, true)).toBe(0x20244ec)
+      expect(view.getUint32(6, true)).toBe(4)
+
+      // Simulate the server's READ_OK response for the same request id
+      const response = new Uint8Array(14)
+      const responseView = new DataView(response.buffer)
+      responseView.setUint8(0, 0x81)
+      responseView.setUint8(1, view.getUint8(1))
+      responseView.setUint32(2, 0x20244ec, true)
+      responseView.setUint32(6, 4, true)
+      response.set([1, 2, 3, 4], 10)
+      internals.handleBinaryMessage(response)
+
+      expect(await pendingRead).toEqual(new Uint8Array([1, 2, 3, 4]))
+    })
+
+    it('should reject on binary error frames', async () => {
+      const sentFrames: Uint8Array[] = []
+      const internals = enableBinary(sentFrames)
+
+      const pendingRead = client.readBytes(0x1000, 2)
+      const requestId = new DataView(sentFrames[0]!.buffer).getUint8(1)
+
+      const errorText = new TextEncoder().encode('Out of range')
+      const response = new Uint8Array(10 + errorText.length)
+      const responseView = new DataView(response.buffer)
+      responseView.setUint8(0, 0xff)
+      responseView.setUint8(1, requestId)
+      response.set(errorText, 10)
+      internals.handleBinaryMessage(response)
+
+      await expect(pendingRead).rejects.toThrow('Out of range')
+    })
+  })
+
+  describe('Read Coalescing and Batching', () => {
+    type ClientInternals = {
+      connected: boolean
+      ws: { send: (data: Uint8Array) => void }
+      binaryProtocolVersion: number
+      handleBinaryMessage: (frame: Uint8Array) => void
+      memoryCache: Map<string, Uint8Array>
+    }
+
+    const enableBinary = (sentFrames: Uint8Array[]) => {
+      const internals = client as unknown as ClientInternals
+      internals.connected = true
+      internals.ws = { send: frame => sentFrames.push(frame) }
+      internals.binaryProtocolVersion = 1
+      return internals
+    }
+
+    /** Answer a captured READ request frame with READ_OK and the given payload */
+    const respondToRead = (internals: ClientInternals, request: Uint8Array, data: number[]) => {
+      const requestView = new DataView(request.buffer)
+      const response = new Uint8Array(10 + data.length)
+      const responseView = new DataView(response.buffer)
+      responseView.setUint8(0, 0x81)
+      responseView.setUint8(1, requestView.getUint8(1))
+      response.set(data, 10)
+      internals.handleBinaryMessage(response)
+    }
+
+    const respondToWrite = (internals: ClientInternals, request: Uint8Array) => {
+      const requestView = new DataView(request.buffer)
+      const response = new Uint8Array(10)
+      new DataView(response.buffer).setUint8(0, 0x82)
+      new DataView(response.buffer).setUint8(1, requestView.getUint8(1))
+      internals.handleBinaryMessage(response)
+    }
+
+    it('should coalesce adjacent batch reads into one round trip', async () => {
+      const sentFrames: Uint8Array[] = []
+      const internals = enableBinary(sentFrames)
+
+      const pending = client.readBatch([
+        { address: 0x1000, size: 4 },
+        { address: 0x1004, size: 4 },
+      ])
+      expect(sentFrames).toHaveLength(1)
+
+      const view = new DataView(sentFrames[0]!.buffer)
+      expect(view.getUint32(2, true)).toBe(0x1000)
+      expect(view.getUint32(6, true)).toBe(8)
+
+      respondToRead(internals, sentFrames[0]!, [1, 2, 3, 4, 5, 6, 7, 8])
+      const [first, second] = await pending
+      expect(first).toEqual(new Uint8Array([1, 2, 3, 4]))
+      expect(second).toEqual(new Uint8Array([5, 6, 7, 8]))
+    })
+
+    it('should pipeline disjoint batch reads instead of serializing them', async () => {
+      const sentFrames: Uint8Array[] = []
+      const internals = enableBinary(sentFrames)
+
+      const pending = client.readBatch([
+        { address: 0x1000, size: 2 },
+        { address: 0x9000, size: 2 },
+      ])
+      // Both requests are on the wire before either response arrives
+      expect(sentFrames).toHaveLength(2)
+
+      respondToRead(internals, sentFrames[1]!, [9, 10])
+      respondToRead(internals, sentFrames[0]!, [1, 2])
+      const [first, second] = await pending
+      expect(first).toEqual(new Uint8Array([1, 2]))
+      expect(second).toEqual(new Uint8Array([9, 10]))
+    })
+
+    it('should share one round trip between identical concurrent reads', async () => {
+      const sentFrames: Uint8Array[] = []
+      const internals = enableBinary(sentFrames)
+
+      const firstRead = client.readBytes(0x2000, 4)
+      const secondRead = client.readBytes(0x2000, 4)
+      expect(sentFrames).toHaveLength(1)
+
+      respondToRead(internals, sentFrames[0]!, [7, 7, 7, 7])
+      expect(await firstRead).toEqual(new Uint8Array([7, 7, 7, 7]))
+      expect(await secondRead).toEqual(new Uint8Array([7, 7, 7, 7]))
+      // Joined callers get their own copy, not a shared mutable buffer
+      expect(await secondRead).not.toBe(await firstRead)
+    })
+
+    it('should serve cached ranges in a batch without touching the wire', async () => {
+      const sentFrames: Uint8Array[] = []
+      const internals = enableBinary(sentFrames)
+      internals.memoryCache.set('4096-4', new Uint8Array([1, 2, 3, 4]))
+
+      const pending = client.readBatch([
+        { address: 4096, size: 4 },
+        { address: 0x5000, size: 2 },
+      ])
+      // Only the uncached range goes out
+      expect(sentFrames).toHaveLength(1)
+      expect(new DataView(sentFrames[0]!.buffer).getUint32(2, true)).toBe(0x5000)
+
+      respondToRead(internals, sentFrames[0]!, [8, 9])
+      const [cached, fetched] = await pending
+      expect(cached).toEqual(new Uint8Array([1, 2, 3, 4]))
+      expect(fetched).toEqual(new Uint8Array([8, 9]))
+    })
+
+    it('should merge adjacent writes with later entries winning overlaps', async () => {
+      const sentFrames: Uint8Array[] = []
+      const internals = enableBinary(sentFrames)
+
+      const pending = client.writeBatch([
+        { address: 0x3000, data: new Uint8Array([1, 1, 1, 1]) },
+        { address: 0x3002, data: new Uint8Array([2, 2, 2, 2]) },
+      ])
+      expect(sentFrames).toHaveLength(1)
+
+      const view = new DataView(sentFrames[0]!.buffer)
+      expect(view.getUint8(0)).toBe(0x02) // WRITE opcode
+      expect(view.getUint32(2, true)).toBe(0x3000)
+      expect(sentFrames[0]!.subarray(10)).toEqual(new Uint8Array([1, 1, 2, 2, 2, 2]))
+
+      respondToWrite(internals, sentFrames[0]!)
+      await pending
+    })
+
+    it('should keep gapped writes as separate concurrent requests', async () => {
+      const sentFrames: Uint8Array[] = []
+      const internals = enableBinary(sentFrames)
+
+      const pending = client.writeBatch([
+        { address: 0x3000, data: new Uint8Array([1]) },
+        { address: 0x4000, data: new Uint8Array([2]) },
+      ])
+      expect(sentFrames).toHaveLength(2)
+
+      respondToWrite(internals, sentFrames[0]!)
+      respondToWrite(internals, sentFrames[1]!)
+      await pending
+    })
+  })
+
   describe('Helper Methods', () => {
     it('should provide connection status', () => {
       expect(typeof client.isConnected()).toBe('boolean')
@@ -15,6 +15,25 @@ import {
 // Re-export types for consumers
 export type { MemoryChangeListener } from './types'
 
+// --- Binary protocol framing ---
+// Requests and responses share a fixed 10-byte little-endian header:
+// [opcode u8][requestId u8][address u32][length u32] followed by an optional
+// raw byte payload. Negotiated at connect() via the BINARY_PROTOCOL_VERSION
+// global exposed by scripts/mgba-lua/http-server.lua; older servers fall back
+// to the Lua eval path transparently.
+const BINARY_HEADER_BYTES = 10
+const BINARY_OP_READ = 0x01
+const BINARY_OP_WRITE = 0x02
+const BINARY_OP_READ_OK = 0x81
+const BINARY_OP_WRITE_OK = 0x82
+const BINARY_OP_ERROR = 0xff
+
+interface PendingBinaryRequest {
+  resolve: (payload: Uint8Array) => void
+  reject: (error: Error) => void
+  timeout: ReturnType<typeof setTimeout>
+}
+
 export class MgbaWebSocketClient {
   private ws: WebSocket | null = null
   private connected = false
@@ -30,6 +49,15 @@ export class MgbaWebSocketClient {
   // Eval request handling
   private readonly pendingEvalHandlers: ((message: SimpleMessage) => boolean)[] = []
 
+  // Binary protocol state (negotiated at connect, 0 = eval fallback only)
+  private binaryProtocolVersion = 0
+  private nextBinaryRequestId = 0
+  private readonly pendingBinaryRequests = new Map<number, PendingBinaryRequest>()
+
+  // In-flight read dedup: concurrent reads of the same range share one
+  // round trip instead of each paying full socket latency
+  private readonly inFlightReads = new Map<string, Promise<Uint8Array>>()
+
   constructor(private readonly url = 'ws://localhost:7102/ws') {}
 
   /**
@@ -41,14 +69,20 @@ export class MgbaWebSocketClient {
     return new Promise((resolve, reject) => {
       try {
         this.ws = new WebSocket(this.url)
+        this.ws.binaryType = 'arraybuffer'
 
         this.ws.addEventListener('open', () => {
           this.connected = true
-          resolve()
+          // Probe for binary protocol support; older servers simply report 0
+          void this.negotiateBinaryProtocol().finally(resolve)
         })
 
         this.ws.addEventListener('message', event => {
           const raw = event.data
+          if (raw instanceof ArrayBuffer) {
+            this.handleBinaryMessage(new Uint8Array(raw))
+            return
+          }
           const data = typeof raw === 'string' ? raw : String(raw)
           this.handleMessage(data)
         })
@@ -141,6 +175,95 @@ export class MgbaWebSocketClient {
     }
   }
 
+  /**
+   * Probe the server for binary protocol support
+   * Older eval-only servers answer 0 and all reads/writes stay on the eval path
+   */
+  private async negotiateBinaryProtocol(): Promise<void> {
+    try {
+      const result = await this.eval('BINARY_PROTOCOL_VERSION or 0')
+      const version = Number(result.result)
+      this.binaryProtocolVersion = Number.isInteger(version) && version > 0 ? version : 0
+    } catch {
+      this.binaryProtocolVersion = 0
+    }
+  }
+
+  /**
+   * Check whether the binary framed protocol was negotiated at connect
+   */
+  supportsBinaryProtocol(): boolean {
+    return this.binaryProtocolVersion > 0
+  }
+
+  /**
+   * Handle binary framed responses (opcode + requestId + address + length header)
+   */
+  private handleBinaryMessage(frame: Uint8Array): void {
+    if (frame.length < BINARY_HEADER_BYTES) {
+      console.warn('Ignoring truncated binary frame:', frame.length)
+      return
+    }
+
+    const view = new DataView(frame.buffer, frame.byteOffset, frame.byteLength)
+    const opcode = view.getUint8(0)
+    const requestId = view.getUint8(1)
+    const payload = frame.subarray(BINARY_HEADER_BYTES)
+
+    const pending = this.pendingBinaryRequests.get(requestId)
+    if (!pending) {
+      console.warn('Received binary frame for unknown request:', requestId)
+      return
+    }
+    this.pendingBinaryRequests.delete(requestId)
+    clearTimeout(pending.timeout)
+
+    if (opcode === BINARY_OP_READ_OK || opcode === BINARY_OP_WRITE_OK) {
+      pending.resolve(payload)
+    } else if (opcode === BINARY_OP_ERROR) {
+      pending.reject(new Error(new TextDecoder().decode(payload) || 'Binary request failed'))
+    } else {
+      pending.reject(new Error(`Unknown binary response opcode: 0x${opcode.toString(16)}`))
+    }
+  }
+
+  /**
+   * Send a binary framed request and wait for the matching response payload
+   */
+  private async sendBinaryRequest(
+    opcode: number,
+    address: number,
+    length: number,
+    payload?: Uint8Array
+  ): Promise<Uint8Array> {
+    if (!this.connected || !this.ws) {
+      throw new Error('Not connected to WebSocket server')
+    }
+
+    const requestId = this.nextBinaryRequestId
+    this.nextBinaryRequestId = (this.nextBinaryRequestId + 1) & 0xff
+
+    const frame = new Uint8Array(BINARY_HEADER_BYTES + (payload?.length ?? 0))
+    const view = new DataView(frame.buffer)
+    view.setUint8(0, opcode)
+    view.setUint8(1, requestId)
+    view.setUint32(2, address, true)
+    view.setUint32(6, length, true)
+    if (payload) {
+      frame.set(payload, BINARY_HEADER_BYTES)
+    }
+
+    return new Promise((resolve, reject) => {
+      const timeout = setTimeout(() => {
+        this.pendingBinaryRequests.delete(requestId)
+        reject(new Error('Binary request timed out'))
+      }, 5000)
+
+      this.pendingBinaryRequests.set(requestId, { resolve, reject, timeout })
+      this.ws!.send(frame)
+    })
+  }
+
   /**
    * Start watching memory regions
    */
@@ -208,7 +331,8 @@ export class MgbaWebSocketClient {
   }
 
   /**
-   * Read bytes from memory - uses cached data if available, otherwise eval with read8
+   * Read bytes from memory - uses cached data if available, then the binary
+   * framed protocol when negotiated, otherwise eval with read8
    */
   async readBytes(address: number, size: number): Promise<Uint8Array> {
     // Check if we can satisfy this read from any watched memory region
@@ -217,7 +341,86 @@ export class MgbaWebSocketClient {
       return cachedData
     }
 
-    // Fall back to direct eval read using read8 (simplest method)
+    return this.fetchBytes(address, size)
+  }
+
+  /**
+   * Read several memory ranges in as few round trips as possible: cached
+   * ranges are served locally, adjacent/overlapping misses are coalesced into
+   * covering spans, and independent spans go out concurrently (the binary
+   * protocol matches responses by request id, the eval path by arrival order,
+   * so neither requires serializing). Results are returned in request order.
+   */
+  async readBatch(
+    requests: readonly { address: number; size: number }[]
+  ): Promise<Uint8Array[]> {
+    const results = new Array<Uint8Array | null>(requests.length).fill(null)
+    const misses: { index: number; address: number; size: number }[] = []
+
+    for (let i = 0; i < requests.length; i++) {
+      const { address, size } = requests[i]!
+      const cached = this.getCachedMemory(address, size)
+      if (cached) {
+        results[i] = cached
+      } else {
+        misses.push({ index: i, address, size })
+      }
+    }
+    if (misses.length === 0) return results as Uint8Array[]
+
+    // Coalesce misses into covering spans (adjacent or overlapping ranges
+    // merge; a gap starts a new span so we never read unrelated memory)
+    misses.sort((a, b) => a.address - b.address || a.size - b.size)
+    const spans: { address: number; end: number; members: typeof misses }[] = []
+    for (const miss of misses) {
+      const span = spans[spans.length - 1]
+      if (span && miss.address <= span.end) {
+        span.end = Math.max(span.end, miss.address + miss.size)
+        span.members.push(miss)
+      } else {
+        spans.push({ address: miss.address, end: miss.address + miss.size, members: [miss] })
+      }
+    }
+
+    await Promise.all(
+      spans.map(async span => {
+        const bytes = await this.fetchBytes(span.address, span.end - span.address)
+        for (const member of span.members) {
+          const start = member.address - span.address
+          results[member.index] = bytes.slice(start, start + member.size)
+        }
+      })
+    )
+    return results as Uint8Array[]
+  }
+
+  /**
+   * Issue an uncached read over the wire, joining an identical in-flight
+   * request when one exists
+   */
+  private async fetchBytes(address: number, size: number): Promise<Uint8Array> {
+    const key = `${address}-${size}`
+    const pending = this.inFlightReads.get(key)
+    if (pending) {
+      // Copy so concurrent callers cannot observe each other's mutations
+      return (await pending).slice()
+    }
+
+    const request = this.supportsBinaryProtocol()
+      ? this.sendBinaryRequest(BINARY_OP_READ, address, size)
+      : this.evalReadBytes(address, size)
+    this.inFlightReads.set(key, request)
+    try {
+      return await request
+    } finally {
+      this.inFlightReads.delete(key)
+    }
+  }
+
+  /**
+   * Eval-path read using read8 (for servers without the binary protocol)
+   */
+  private async evalReadBytes(address: number, size: number): Promise<Uint8Array> {
     // Convert address to hex to avoid issues with large decimal numbers in Lua
     const hexAddress = `0x${address.toString(16)}`
     const code = `
@@ -268,6 +471,64 @@ export class MgbaWebSocketClient {
    * Write bytes to memory
    */
   async writeBytes(address: number, data: Uint8Array): Promise<void> {
+    if (this.supportsBinaryProtocol()) {
+      await this.sendBinaryRequest(BINARY_OP_WRITE, address, data.length, data)
+      return
+    }
+
+    await this.evalWriteBytes(address, data)
+  }
+
+  /**
+   * Write several memory ranges, merging adjacent/overlapping writes into
+   * contiguous spans (one round trip each) and sending independent spans
+   * concurrently. Later entries win where writes overlap, matching the result
+   * of issuing them sequentially.
+   */
+  async writeBatch(writes: readonly { address: number; data: Uint8Array }[]): Promise<void> {
+    if (writes.length === 0) return
+    if (writes.length === 1) {
+      const { address, data } = writes[0]!
+      await this.writeBytes(address, data)
+      return
+    }
+
+    // First pass: span extents (gaps must stay separate writes, since a
+    // merged buffer would clobber the bytes in between)
+    const sorted = [...writes].sort((a, b) => a.address - b.address)
+    const spans: { address: number; end: number }[] = []
+    for (const write of sorted) {
+      const span = spans[spans.length - 1]
+      if (span && write.address <= span.end) {
+        span.end = Math.max(span.end, write.address + write.data.length)
+      } else {
+        spans.push({ address: write.address, end: write.address + write.data.length })
+      }
+    }
+
+    // Second pass: apply the writes in caller order so overlaps resolve the
+    // same way sequential writeBytes calls would
+    const buffers = spans.map(span => new Uint8Array(span.end - span.address))
+    for (const write of writes) {
+      const spanIndex = spans.findIndex(
+        span => write.address >= span.address && write.address + write.data.length <= span.end
+      )
+      buffers[spanIndex]!.set(write.data, write.address - spans[spanIndex]!.address)
+    }
+
+    await Promise.all(
+      spans.map((span, i) =>
+        this.supportsBinaryProtocol()
+          ? this.sendBinaryRequest(BINARY_OP_WRITE, span.address, buffers[i]!.length, buffers[i]!)
+          : this.evalWriteBytes(span.address, buffers[i]!)
+      )
+    )
+  }
+
+  /**
+   * Eval-path write using write8 (for servers without the binary protocol)
+   */
+  private async evalWriteBytes(address: number, data: Uint8Array): Promise<void> {
     const bytes = [...data].join(',')
     // Convert address to hex to avoid issues with large decimal numbers in Lua
     const hexAddress = `0x${address.toString(16)}`
@@ -332,6 +593,13 @@ export class MgbaWebSocketClient {
     this.watchedRegions = []
     this.memoryCache.clear()
     this.pendingEvalHandlers.length = 0
+    this.binaryProtocolVersion = 0
+    this.inFlightReads.clear()
+    for (const pending of this.pendingBinaryRequests.values()) {
+      clearTimeout(pending.timeout)
+      pending.reject(new Error('Disconnected from WebSocket server'))
+    }
+    this.pendingBinaryRequests.clear()
   }
 
   /**
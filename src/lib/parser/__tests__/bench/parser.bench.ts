@@ -0,0 +1,119 @@
+/**
+ * Benchmarks for the parser's hot paths, run via `npm run bench`.
+ * Results land in bench-results.json; compare against the checked-in
+ * baseline with `npm run bench:check` (see scripts/compare-bench.ts).
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { bench, describe } from 'vitest'
+import { PokemonBase } from '../../core/PokemonBase'
+import { PokemonSaveParser } from '../../core/PokemonSaveParser'
+import { bytesToGbaString, gbaStringToBytes } from '../../core/utils'
+import { QuetzalConfig } from '../../games/quetzal/config'
+import { VanillaConfig } from '../../games/vanilla/config'
+
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+const loadSave = (name: string): ArrayBuffer =>
+  readFileSync(resolve(__dirname, '..', 'test_data', name)).buffer as ArrayBuffer
+
+const emeraldSave = loadSave('emerald.sav')
+const quetzalSave = loadSave('quetzal.sav')
+
+// Private/protected members are reached through the repo's usual cast idiom
+type ParserInternals = {
+  calculateSectorChecksum(sectorData: Uint8Array): number
+}
+type PokemonInternals = {
+  getDecryptedSubstruct(data: Uint8Array, substructIndex: number): Uint8Array
+  setEncryptedSubstruct(substructIndex: number, decryptedData: Uint8Array): void
+  data: Uint8Array
+}
+
+describe('PokemonSaveParser.parse', () => {
+  bench('vanilla save (full parse)', async () => {
+    const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    await parser.parse(emeraldSave)
+  })
+
+  bench('quetzal save (full parse)', async () => {
+    const parser = new PokemonSaveParser(undefined, new QuetzalConfig())
+    await parser.parse(quetzalSave)
+  })
+})
+
+describe('calculateSectorChecksum', () => {
+  const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+  const internals = parser as unknown as ParserInternals
+  const sector = new Uint8Array(emeraldSave, 0, 4096)
+
+  bench('single 3968-byte sector', () => {
+    internals.calculateSectorChecksum(sector)
+  })
+})
+
+describe('PokemonBase substruct encryption', () => {
+  const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+  let pokemon: PokemonBase
+
+  bench(
+    'decrypt/encrypt round-trip (all four substructs)',
+    () => {
+      const internals = pokemon as unknown as PokemonInternals
+      for (let i = 0; i < 4; i++) {
+        // Re-encrypting invalidates the cache, so the next read re-decrypts
+        const decrypted = internals.getDecryptedSubstruct(internals.data, i)
+        internals.setEncryptedSubstruct(i, decrypted)
+      }
+    },
+    {
+      async setup() {
+        const saveData = await parser.parse(emeraldSave)
+        pokemon = saveData.party_pokemon[0]!
+      },
+    }
+  )
+})
+
+describe('GBA text codec', () => {
+  const encoded = gbaStringToBytes('TRAINER', 10)
+
+  bench('bytesToGbaString (10-byte name)', () => {
+    bytesToGbaString(encoded)
+  })
+
+  bench('gbaStringToBytes (10-byte name)', () => {
+    gbaStringToBytes('TRAINER', 10)
+  })
+})
+
+describe('reconstructSaveFile', () => {
+  const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+  let party: PokemonBase[] = []
+
+  const setup = async () => {
+    const saveData = await parser.parse(emeraldSave)
+    party = saveData.party_pokemon
+  }
+
+  bench(
+    'clean party (dirty tracking fast path)',
+    () => {
+      parser.reconstructSaveFile(party, { reuseBuffer: true })
+    },
+    { setup }
+  )
+
+  bench(
+    'one mutated slot (patch + re-checksum)',
+    () => {
+      const first = party[0]!
+      first.hpEV = first.hpEV === 0 ? 4 : 0
+      parser.reconstructSaveFile(party, { reuseBuffer: true })
+    },
+    { setup }
+  )
+})
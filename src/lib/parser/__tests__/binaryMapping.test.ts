@@ -0,0 +1,64 @@
+/**
+ * Unit tests for BinaryMapping compact ID mapping tables
+ * Verifies parity with createMapping and binary round-tripping
+ */
+
+import { describe, expect, it } from 'vitest'
+import { BinaryMapping } from '../core/BinaryMapping'
+import { createMapping } from '../core/utils'
+import type { PokemonMapping } from '../core/types'
+import pokemonMapData from '../games/vanilla/data/pokemon_map.json'
+
+describe('BinaryMapping', () => {
+  const jsonData = pokemonMapData as Record<string, unknown>
+
+  it('should match createMapping entry-for-entry', () => {
+    const reference = createMapping<PokemonMapping>(jsonData)
+    const binary = BinaryMapping.fromJson<PokemonMapping>(jsonData)
+
+    expect(binary.size).toBe(reference.size)
+    for (const [key, expected] of reference.entries()) {
+      const entry = binary.get(key)
+      expect(entry?.id).toBe(expected.id)
+      expect(entry?.name).toBe(expected.name)
+      expect(entry?.id_name).toBe(expected.id_name)
+    }
+  })
+
+  it('should return undefined for unmapped keys', () => {
+    const binary = BinaryMapping.fromJson<PokemonMapping>(jsonData)
+    expect(binary.get(0xffff)).toBeUndefined()
+    expect(binary.has(0xffff)).toBe(false)
+  })
+
+  it('should memoize decoded entries', () => {
+    const binary = BinaryMapping.fromJson<PokemonMapping>(jsonData)
+    const first = binary.get(277)
+    expect(first?.name).toBe('Treecko')
+    expect(binary.get(277)).toBe(first)
+  })
+
+  it('should round-trip through the binary format', () => {
+    const original = BinaryMapping.fromJson<PokemonMapping>(jsonData)
+    const decoded = BinaryMapping.decode<PokemonMapping>(original.encode())
+
+    expect(decoded.size).toBe(original.size)
+    for (const [key, expected] of original.entries()) {
+      expect(decoded.get(key)).toEqual(expected)
+    }
+  })
+
+  it('should reject buffers without the table magic', () => {
+    expect(() => BinaryMapping.decode(new Uint8Array([1, 2, 3, 4]))).toThrow('bad magic')
+  })
+
+  it('should support ReadonlyMap iteration', () => {
+    const binary = BinaryMapping.fromJson<PokemonMapping>(jsonData)
+    const keys = [...binary.keys()]
+    expect(keys.length).toBe(binary.size)
+    // Keys are stored sorted for binary search
+    for (let i = 1; i < keys.length; i++) {
+      expect(keys[i]!).toBeGreaterThan(keys[i - 1]!)
+    }
+  })
+})
@@ -0,0 +1,83 @@
+/**
+ * Tests for lazy PC box storage parsing
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { beforeAll, describe, expect, it } from 'vitest'
+import { BOX_COUNT, POKEMON_PER_BOX } from '../core/BoxStorage'
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import { VanillaConfig } from '../games/vanilla/config'
+
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+describe('PC box storage', () => {
+  let parser: PokemonSaveParser
+
+  beforeAll(async () => {
+    const savePath = resolve(__dirname, 'test_data', 'emerald.sav')
+    const buffer = readFileSync(savePath).buffer as ArrayBuffer
+    parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    await parser.parse(buffer)
+  })
+
+  it('should require a parsed save before exposing box storage', () => {
+    const fresh = new PokemonSaveParser(undefined, new VanillaConfig())
+    expect(() => fresh.getBoxStorage()).toThrow('Save data and config not loaded')
+  })
+
+  it('should expose 14 boxes of 30 slots with a valid current box', () => {
+    const storage = parser.getBoxStorage()
+    expect(storage.boxCount).toBe(BOX_COUNT)
+    expect(storage.pokemonPerBox).toBe(POKEMON_PER_BOX)
+    expect(storage.currentBoxIndex).toBeGreaterThanOrEqual(0)
+    expect(storage.currentBoxIndex).toBeLessThan(BOX_COUNT)
+  })
+
+  it('should produce per-box species summaries without decoding', () => {
+    const storage = parser.getBoxStorage()
+    for (let box = 0; box < BOX_COUNT; box++) {
+      const summary = storage.getBoxSummary(box)
+      expect(summary).toHaveLength(POKEMON_PER_BOX)
+      for (const species of summary) {
+        expect(species).toBeGreaterThanOrEqual(0)
+      }
+    }
+  })
+
+  it('should decode boxes consistently with their summaries', () => {
+    const storage = parser.getBoxStorage()
+    for (let boxIndex = 0; boxIndex < BOX_COUNT; boxIndex++) {
+      const summary = storage.getBoxSummary(boxIndex)
+      const box = storage.getBox(boxIndex)
+      expect(box).toHaveLength(POKEMON_PER_BOX)
+      for (let slot = 0; slot < POKEMON_PER_BOX; slot++) {
+        if (summary[slot] === 0) {
+          expect(box[slot]).toBeNull()
+        } else {
+          expect(box[slot]?.speciesId).toBe(summary[slot])
+        }
+      }
+    }
+  })
+
+  it('should cache decoded boxes and summaries by identity', () => {
+    const storage = parser.getBoxStorage()
+    expect(storage.getBox(0)).toBe(storage.getBox(0))
+    expect(storage.getBoxSummary(0)).toBe(storage.getBoxSummary(0))
+    storage.clearCache()
+    expect(storage.getBoxSummary(0)).toEqual(storage.getBoxSummary(0))
+  })
+
+  it('should reuse the same storage instance per loaded save', () => {
+    expect(parser.getBoxStorage()).toBe(parser.getBoxStorage())
+  })
+
+  it('should reject out-of-range box indices', () => {
+    const storage = parser.getBoxStorage()
+    expect(() => storage.getBox(-1)).toThrow('Box index must be 0-13')
+    expect(() => storage.getBox(BOX_COUNT)).toThrow('Box index must be 0-13')
+  })
+})
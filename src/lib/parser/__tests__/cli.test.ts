@@ -4,7 +4,7 @@
  */
 
 import { execSync } from 'child_process'
-import { writeFileSync, mkdirSync, rmSync } from 'fs'
+import { writeFileSync, mkdirSync, readFileSync, rmSync } from 'fs'
 import { dirname, resolve } from 'path'
 import { fileURLToPath } from 'url'
 import { beforeAll, afterAll, describe, expect, it } from 'vitest'
@@ -129,6 +129,50 @@ describe('Parser CLI Tests', () => {
     })
   })
 
+  describe('Batch mode', () => {
+    it('should emit one NDJSON record per save file with --batch', () => {
+      const batchDir = resolve(tempDir, 'batch')
+      mkdirSync(batchDir, { recursive: true })
+      writeFileSync(resolve(batchDir, 'copy1.sav'), readFileSync(testSavePath))
+      writeFileSync(resolve(batchDir, 'copy2.sav'), readFileSync(testSavePath))
+
+      const result = execSync(`tsx "${cliPath}" --batch="${batchDir}"`, {
+        encoding: 'utf8',
+        stdio: ['pipe', 'pipe', 'pipe'],
+      })
+      const records = result
+        .trim()
+        .split('\n')
+        .map(line => JSON.parse(line) as { file: string; player_name: string })
+
+      expect(records).toHaveLength(2)
+      expect(records[0]?.player_name).toBe('John')
+      expect(records[1]?.player_name).toBe('John')
+    })
+
+    it('should report parse failures without aborting the batch', () => {
+      const batchDir = resolve(tempDir, 'batch-mixed')
+      mkdirSync(batchDir, { recursive: true })
+      writeFileSync(resolve(batchDir, 'bad.sav'), Buffer.alloc(1000, 0xff))
+      writeFileSync(resolve(batchDir, 'good.sav'), readFileSync(testSavePath))
+
+      try {
+        execSync(`tsx "${cliPath}" --batch="${batchDir}"`, { encoding: 'utf8', stdio: 'pipe' })
+        expect.unreachable('batch with failures should exit non-zero')
+      } catch (error: unknown) {
+        const execError = error as Error & { stdout?: string; status?: number }
+        const records = (execError.stdout ?? '')
+          .trim()
+          .split('\n')
+          .map(line => JSON.parse(line) as { file: string; error?: string })
+
+        expect(records).toHaveLength(2)
+        expect(records.filter(r => r.error)).toHaveLength(1)
+        expect(execError.status).toBe(1)
+      }
+    })
+  })
+
   describe('CLI flag combinations', () => {
     it('should prioritize string conversion over file parsing', () => {
       const result = execSync(`tsx "${cliPath}" "${testSavePath}" --toBytes=PIKACHU`, {
@@ -0,0 +1,76 @@
+/**
+ * Tests for two-phase game detection with the shared DetectionContext
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { describe, expect, it } from 'vitest'
+import { buildDetectionContext } from '../core/GameConfigBase'
+import { gameConfigRegistry } from '../core/GameConfigRegistry'
+import { QuetzalConfig } from '../games/quetzal/config'
+import { VanillaConfig } from '../games/vanilla/config'
+import '../games' // ensure configs are registered
+
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+const loadSave = (name: string): Uint8Array =>
+  new Uint8Array(readFileSync(resolve(__dirname, 'test_data', name)))
+
+describe('Two-phase game detection', () => {
+  it('should detect vanilla and Quetzal saves through the shared context', async () => {
+    expect(await gameConfigRegistry.resolveConfig(loadSave('emerald.sav'))).toBeInstanceOf(
+      VanillaConfig
+    )
+    expect(await gameConfigRegistry.resolveConfig(loadSave('quetzal.sav'))).toBeInstanceOf(
+      QuetzalConfig
+    )
+  })
+
+  it('should reject garbage data in the pre-screen phase', async () => {
+    expect(await gameConfigRegistry.resolveConfig(new Uint8Array(131072))).toBeNull()
+    expect(await gameConfigRegistry.resolveConfig(new Uint8Array(16))).toBeNull()
+  })
+
+  it('should serve synchronous detection once the winner is loaded', async () => {
+    // Lazily registered configs are invisible to the sync path until their
+    // module has been imported by a resolve or loadByName
+    await gameConfigRegistry.resolveConfig(loadSave('quetzal.sav'))
+    expect(gameConfigRegistry.detectGameConfig(loadSave('quetzal.sav'))).toBeInstanceOf(
+      QuetzalConfig
+    )
+    expect(gameConfigRegistry.findLoadedByName('Pokemon Quetzal')).toBeInstanceOf(QuetzalConfig)
+  })
+
+  it('should load configs by name for cross-thread hydration', async () => {
+    const config = await gameConfigRegistry.loadByName('Pokemon Emerald (Vanilla)')
+    expect(config).toBeInstanceOf(VanillaConfig)
+    // Repeated loads return the cached instance
+    expect(await gameConfigRegistry.loadByName('Pokemon Emerald (Vanilla)')).toBe(config)
+    expect(await gameConfigRegistry.loadByName('Unknown Game')).toBeNull()
+  })
+
+  it('should precompute signature facts and sector map once', () => {
+    const context = buildDetectionContext(loadSave('emerald.sav'))
+    expect(context.saveSizeValid).toBe(true)
+    expect(context.validSignatureCount).toBeGreaterThanOrEqual(8)
+    expect(context.hasEmeraldSignature).toBe(true)
+    for (const sectorId of [1, 2, 3, 4]) {
+      expect(context.sectorMap.has(sectorId)).toBe(true)
+    }
+  })
+
+  it('should cache the extracted SaveBlock1 across candidates', () => {
+    const context = buildDetectionContext(loadSave('quetzal.sav'))
+    const first = context.getSaveBlock1()
+    expect(first).not.toBeNull()
+    expect(context.getSaveBlock1()).toBe(first)
+  })
+
+  it('should let configs rule themselves out without Pokemon bytes', () => {
+    const context = buildDetectionContext(new Uint8Array(131072))
+    expect(new VanillaConfig().preScreen(context)).toBe(false)
+    expect(new QuetzalConfig().preScreen(context)).toBe(false)
+  })
+})
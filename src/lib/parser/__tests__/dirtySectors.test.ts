@@ -0,0 +1,93 @@
+/**
+ * Tests for dirty-sector tracking in reconstructSaveFile
+ * Verifies only mutated party slots trigger sector rewrites and that the
+ * reusable output buffer keeps round-trip behavior intact
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { beforeEach, describe, expect, it } from 'vitest'
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import { VanillaConfig } from '../games/vanilla/config'
+
+// Handle ES modules in Node.js
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+describe('PokemonSaveParser.reconstructSaveFile dirty tracking', () => {
+  let parser: PokemonSaveParser
+  let testSaveData: ArrayBuffer
+
+  beforeEach(() => {
+    parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    const savePath = resolve(__dirname, 'test_data', 'emerald.sav')
+    const saveBuffer = readFileSync(savePath)
+    testSaveData = saveBuffer.buffer.slice(
+      saveBuffer.byteOffset,
+      saveBuffer.byteOffset + saveBuffer.byteLength
+    )
+  })
+
+  it('should mark Pokemon dirty through setters and clear after reconstruction', async () => {
+    const result = await parser.parse(testSaveData)
+    const pokemon = result.party_pokemon[0]!
+
+    expect(pokemon.isDirty).toBe(false)
+    pokemon.hpEV = Math.min(255, pokemon.hpEV + 1)
+    expect(pokemon.isDirty).toBe(true)
+
+    parser.reconstructSaveFile(result.party_pokemon)
+    expect(pokemon.isDirty).toBe(false)
+  })
+
+  it('should return an unchanged save when no Pokemon mutated', async () => {
+    const result = await parser.parse(testSaveData)
+    const reconstructed = parser.reconstructSaveFile(result.party_pokemon)
+
+    expect(reconstructed).toEqual(new Uint8Array(testSaveData))
+  })
+
+  it('should round-trip edits made after a previous reconstruction', async () => {
+    const result = await parser.parse(testSaveData)
+
+    // First reconstruction seeds the reusable buffer
+    parser.reconstructSaveFile(result.party_pokemon)
+
+    // A later edit must still land in the output, with a valid checksum
+    const pokemon = result.party_pokemon[0]!
+    const newEV = pokemon.hpEV === 0 ? 4 : 0
+    pokemon.hpEV = newEV
+    const reconstructed = parser.reconstructSaveFile(result.party_pokemon)
+
+    const verifyParser = new PokemonSaveParser(undefined, new VanillaConfig())
+    const reparsed = await verifyParser.parse(reconstructed.buffer.slice(0))
+    expect(reparsed.party_pokemon[0]!.hpEV).toBe(newEV)
+  })
+
+  it('should pick up reordered parties even without dirty flags', async () => {
+    const result = await parser.parse(testSaveData)
+    if (result.party_pokemon.length < 2) return
+
+    const swapped = [...result.party_pokemon]
+    ;[swapped[0], swapped[1]] = [swapped[1]!, swapped[0]!]
+    const reconstructed = parser.reconstructSaveFile(swapped)
+
+    const verifyParser = new PokemonSaveParser(undefined, new VanillaConfig())
+    const reparsed = await verifyParser.parse(reconstructed.buffer.slice(0))
+    expect(reparsed.party_pokemon[0]!.speciesId).toBe(result.party_pokemon[1]!.speciesId)
+    expect(reparsed.party_pokemon[1]!.speciesId).toBe(result.party_pokemon[0]!.speciesId)
+  })
+
+  it('should return independent copies unless reuseBuffer is requested', async () => {
+    const result = await parser.parse(testSaveData)
+
+    const first = parser.reconstructSaveFile(result.party_pokemon)
+    const second = parser.reconstructSaveFile(result.party_pokemon)
+    expect(first.buffer).not.toBe(second.buffer)
+
+    const reusedA = parser.reconstructSaveFile(result.party_pokemon, { reuseBuffer: true })
+    const reusedB = parser.reconstructSaveFile(result.party_pokemon, { reuseBuffer: true })
+    expect(reusedA.buffer).toBe(reusedB.buffer)
+  })
+})
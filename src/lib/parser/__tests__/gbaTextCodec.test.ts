@@ -0,0 +1,54 @@
+/**
+ * Tests for the shared GBA text codec
+ * The per-string behaviors are covered through bytesToGbaString in
+ * pokemonSaveParser.unit.test.ts; this focuses on the codec's own API and
+ * the bulk fixed-width decode path
+ */
+
+import { describe, expect, it } from 'vitest'
+import {
+  GBA_TEXT_TERMINATOR,
+  decodeGbaText,
+  decodeGbaTextAll,
+  encodeGbaTextInto,
+} from '../core/GbaTextCodec'
+import { gbaStringToBytes } from '../core/utils'
+
+describe('GbaTextCodec', () => {
+  it('should stop terminator-aware decoding at 0xFF', () => {
+    // 0xBB..0xBD = A..C in the GBA charmap
+    const bytes = new Uint8Array([0xbb, 0xbc, GBA_TEXT_TERMINATOR, 0xbd])
+    expect(decodeGbaText(bytes)).toBe('AB')
+  })
+
+  it('should decode a bounded range of a larger buffer', () => {
+    const buffer = new Uint8Array([0x00, 0xbb, 0xbc, 0xbd, 0x00])
+    expect(decodeGbaText(buffer, 1, 4)).toBe('ABC')
+  })
+
+  it('should decode many fixed-width strings in one pass', () => {
+    // Three 10-byte nickname slots packed back to back
+    const names = ['ABC', 'D', 'EF']
+    const buffer = new Uint8Array(30).fill(GBA_TEXT_TERMINATOR)
+    names.forEach((name, slot) => encodeGbaTextInto(name, buffer, slot * 10, 10))
+
+    expect(decodeGbaTextAll(buffer, 10, 3)).toEqual(names)
+  })
+
+  it('should honor offset and width when entries carry trailing fields', () => {
+    // Entries of 12 bytes where only the first 10 are the name
+    const buffer = new Uint8Array(24).fill(GBA_TEXT_TERMINATOR)
+    encodeGbaTextInto('AB', buffer, 0, 10)
+    encodeGbaTextInto('CD', buffer, 12, 10)
+    buffer[10] = 0xbb // non-name byte that width must exclude
+    buffer[22] = 0xbb
+
+    expect(decodeGbaTextAll(buffer, 12, 2, { width: 10 })).toEqual(['AB', 'CD'])
+  })
+
+  it('should round-trip through the shared encode table', () => {
+    const bytes = gbaStringToBytes('ABC', 10)
+    expect(decodeGbaText(bytes)).toBe('ABC')
+    expect(bytes[3]).toBe(GBA_TEXT_TERMINATOR)
+  })
+})
@@ -0,0 +1,56 @@
+/**
+ * Tests for opt-in parse-stage instrumentation
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { afterEach, describe, expect, it } from 'vitest'
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import { VanillaConfig } from '../games/vanilla/config'
+
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+const loadEmerald = (): ArrayBuffer =>
+  readFileSync(resolve(__dirname, 'test_data', 'emerald.sav')).buffer as ArrayBuffer
+
+describe('Parse metrics', () => {
+  afterEach(() => {
+    PokemonSaveParser.setMetricsEnabled(false)
+  })
+
+  it('should collect nothing while disabled', async () => {
+    const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    await parser.parse(loadEmerald())
+    expect(parser.getLastParseMetrics()).toBeNull()
+  })
+
+  it('should record stage timings and sector statistics when enabled', async () => {
+    PokemonSaveParser.setMetricsEnabled(true)
+    const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    await parser.parse(loadEmerald())
+
+    const metrics = parser.getLastParseMetrics()
+    expect(metrics).not.toBeNull()
+    expect(metrics!.totalMs).toBeGreaterThan(0)
+    for (const duration of Object.values(metrics!.stages)) {
+      expect(duration).toBeGreaterThanOrEqual(0)
+    }
+    // Slot determination scans both slots' footers exactly once; the sector
+    // map pass then hits the cache for the active slot
+    expect(metrics!.sectorsScanned).toBeGreaterThan(0)
+    expect(metrics!.sectorInfoCacheHits).toBeGreaterThan(0)
+    // Party slices are materialized as writable copies
+    expect(metrics!.bytesCopied).toBeGreaterThanOrEqual(0)
+  })
+
+  it('should keep metrics from the last parse only', async () => {
+    PokemonSaveParser.setMetricsEnabled(true)
+    const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    await parser.parse(loadEmerald())
+    const first = parser.getLastParseMetrics()
+    await parser.parse(loadEmerald())
+    expect(parser.getLastParseMetrics()).not.toBe(first)
+  })
+})
@@ -0,0 +1,131 @@
+/**
+ * Tests for the SharedArrayBuffer-backed live party mirror
+ * Verifies zero-copy reads, seqlock generation semantics and consistent
+ * snapshots across the writer/reader split
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { beforeEach, describe, expect, it } from 'vitest'
+import { PartyMirror } from '../core/PartyMirror'
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import type { PokemonBase } from '../core/PokemonBase'
+import { VanillaConfig } from '../games/vanilla/config'
+
+// Handle ES modules in Node.js
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+describe('PartyMirror', () => {
+  let config: VanillaConfig
+  let party: PokemonBase[]
+
+  beforeEach(async () => {
+    config = new VanillaConfig()
+    const parser = new PokemonSaveParser(undefined, config)
+    const savePath = resolve(__dirname, 'test_data', 'emerald.sav')
+    const saveBuffer = readFileSync(savePath)
+    const result = await parser.parse(
+      saveBuffer.buffer.slice(saveBuffer.byteOffset, saveBuffer.byteOffset + saveBuffer.byteLength)
+    )
+    party = result.party_pokemon
+    expect(party.length).toBeGreaterThan(0)
+  })
+
+  it('should mirror published party bytes into attached readers without copies', () => {
+    const writer = PartyMirror.create(config)
+    const reader = PartyMirror.attach(writer.buffer, config)
+
+    writer.publish(party)
+
+    expect(reader.partyCount).toBe(party.length)
+    const mirrored = reader.readParty()
+    expect(mirrored.length).toBe(party.length)
+    for (let slot = 0; slot < party.length; slot++) {
+      expect(mirrored[slot]!.speciesId).toBe(party[slot]!.speciesId)
+      expect(mirrored[slot]!.currentHp).toBe(party[slot]!.currentHp)
+    }
+    // View objects are reused across reads; the bytes underneath are shared
+    expect(reader.readParty()[0]).toBe(mirrored[0])
+  })
+
+  it('should advance the generation by two per publish and stay even', () => {
+    const mirror = PartyMirror.create(config)
+    expect(mirror.generation).toBe(0)
+
+    mirror.publish(party)
+    expect(mirror.generation).toBe(2)
+    mirror.publish(party)
+    expect(mirror.generation).toBe(4)
+    expect(mirror.generation % 2).toBe(0)
+  })
+
+  it('should expose new values through existing live views after a republish', () => {
+    const writer = PartyMirror.create(config)
+    const reader = PartyMirror.attach(writer.buffer, config)
+    writer.publish(party)
+    const view = reader.readParty()[0]!
+    const originalMaxHp = view.maxHp
+
+    party[0]!.maxHp = originalMaxHp + 1
+    writer.publish(party)
+
+    // Same view object, fresh bytes
+    expect(view.maxHp).toBe(originalMaxHp + 1)
+  })
+
+  it('should zero abandoned slots when the party shrinks', () => {
+    const writer = PartyMirror.create(config)
+    const reader = PartyMirror.attach(writer.buffer, config)
+    writer.publish(party)
+    writer.publish(party.slice(0, 1))
+
+    expect(reader.partyCount).toBe(1)
+    expect(reader.readParty().length).toBe(1)
+    // Bytes past the shrunk party are cleared, not stale
+    const raw = new Uint8Array(writer.buffer)
+    const headerBytes = 4 * Int32Array.BYTES_PER_ELEMENT
+    const secondSlot = raw.subarray(
+      headerBytes + config.pokemonSize,
+      headerBytes + 2 * config.pokemonSize
+    )
+    expect(secondSlot.every(byte => byte === 0)).toBe(true)
+  })
+
+  it('should produce snapshots decoupled from later publishes', () => {
+    const writer = PartyMirror.create(config)
+    const reader = PartyMirror.attach(writer.buffer, config)
+    writer.publish(party)
+
+    const { generation, party: frozen } = reader.snapshot()
+    expect(generation).toBe(2)
+    const maxHpBefore = frozen[0]!.maxHp
+
+    party[0]!.maxHp = maxHpBefore + 5
+    writer.publish(party)
+
+    expect(frozen[0]!.maxHp).toBe(maxHpBefore)
+    expect(reader.snapshot().party[0]!.maxHp).toBe(maxHpBefore + 5)
+  })
+
+  it('should resolve waitForChange on publish and time out otherwise', async () => {
+    const writer = PartyMirror.create(config)
+    const reader = PartyMirror.attach(writer.buffer, config)
+
+    const pending = reader.waitForChange(reader.generation, 1000)
+    writer.publish(party)
+    expect(await pending).toBe(true)
+
+    expect(await reader.waitForChange(reader.generation, 20)).toBe(false)
+  })
+
+  it('should reject attaching with a mismatched config layout', () => {
+    const writer = PartyMirror.create(config)
+    const otherConfig = Object.create(config) as VanillaConfig
+    Object.defineProperty(otherConfig, 'pokemonSize', { value: config.pokemonSize + 4 })
+    expect(() => PartyMirror.attach(writer.buffer, otherConfig)).toThrow(
+      'Party mirror layout mismatch'
+    )
+  })
+})
@@ -0,0 +1,84 @@
+/**
+ * Tests for per-config specialized Pokemon accessor classes
+ * The baked-offset getters must agree byte for byte with the dynamic
+ * PokemonBase lookups for every supported layout
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { describe, expect, it } from 'vitest'
+import { createPokemon, getPokemonClass } from '../core/PokemonAccessors'
+import { PokemonBase } from '../core/PokemonBase'
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import { QuetzalConfig } from '../games/quetzal/config'
+import { VanillaConfig } from '../games/vanilla/config'
+import type { GameConfig } from '../core/types'
+
+// Handle ES modules in Node.js
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+const loadSave = (name: string): ArrayBuffer => {
+  const buffer = readFileSync(resolve(__dirname, 'test_data', name))
+  return buffer.buffer.slice(buffer.byteOffset, buffer.byteOffset + buffer.byteLength)
+}
+
+const BAKED_FIELDS = [
+  'personality',
+  'otId',
+  'currentHp',
+  'status',
+  'level',
+  'maxHp',
+  'attack',
+  'defense',
+  'speed',
+  'spAttack',
+  'spDefense',
+] as const
+
+describe('PokemonAccessors', () => {
+  it('should reuse one specialized class per config class', () => {
+    const first = getPokemonClass(new VanillaConfig())
+    const second = getPokemonClass(new VanillaConfig())
+    expect(second).toBe(first)
+    expect(getPokemonClass(new QuetzalConfig())).not.toBe(first)
+  })
+
+  it.each([
+    ['emerald.sav', () => new VanillaConfig()],
+    ['quetzal.sav', () => new QuetzalConfig()],
+  ])('should match dynamic lookups for every baked field (%s)', async (fixture, makeConfig) => {
+    const parser = new PokemonSaveParser(undefined, makeConfig())
+    const result = await parser.parse(loadSave(fixture))
+    expect(result.party_pokemon.length).toBeGreaterThan(0)
+
+    const config = makeConfig()
+    for (const pokemon of result.party_pokemon) {
+      const reference = new PokemonBase(pokemon.rawBytes, config)
+      const specialized = createPokemon(pokemon.rawBytes, config)
+      expect(specialized).toBeInstanceOf(PokemonBase)
+      for (const field of BAKED_FIELDS) {
+        expect(specialized[field]).toBe(reference[field])
+      }
+    }
+  })
+
+  it('should write through baked setters and mark the Pokemon dirty', async () => {
+    const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    const result = await parser.parse(loadSave('emerald.sav'))
+    const pokemon = createPokemon(result.party_pokemon[0]!.rawBytes, new VanillaConfig())
+
+    expect(pokemon.isDirty).toBe(false)
+    pokemon.maxHp = pokemon.maxHp + 1
+    expect(pokemon.isDirty).toBe(true)
+    expect(createPokemon(pokemon.rawBytes, new VanillaConfig()).maxHp).toBe(pokemon.maxHp)
+  })
+
+  it('should fall back to PokemonBase for ad-hoc object-literal configs', () => {
+    const vanilla = new VanillaConfig()
+    const literalConfig = { ...vanilla } as unknown as GameConfig
+    expect(getPokemonClass(literalConfig)).toBe(PokemonBase)
+  })
+})
@@ -7,7 +7,7 @@ import { beforeAll, describe, expect, it } from 'vitest'
 import { PokemonSaveParser } from '../core/PokemonSaveParser'
 import { QuetzalConfig } from '../games/quetzal/config'
 import { VanillaConfig } from '../games/vanilla/config'
-import { bytesToGbaString } from '../core/utils'
+import { bytesToGbaString, encodeGbaStrings, gbaStringToBytes } from '../core/utils'
 
 describe('Pokemon Save Parser - Unit Tests', () => {
   let quetzalConfig: QuetzalConfig
@@ -202,6 +202,30 @@ describe('Pokemon Save Parser - Unit Tests', () => {
     })
   })
 
+  describe('Text Encoding', () => {
+    it('should round-trip strings through gbaStringToBytes', () => {
+      const bytes = gbaStringToBytes('AB', 10)
+      expect(bytes.length).toBe(10)
+      expect(bytesToGbaString(bytes)).toBe('AB')
+      // Unused slots are 0xFF padding
+      expect(bytes[2]).toBe(0xff)
+      expect(bytes[9]).toBe(0xff)
+    })
+
+    it('should batch-encode strings into one buffer with encodeGbaStrings', () => {
+      const buffer = encodeGbaStrings(['AB', 'ABC'], 8)
+      expect(buffer.length).toBe(16)
+      expect(bytesToGbaString(buffer.subarray(0, 8))).toBe('AB')
+      expect(bytesToGbaString(buffer.subarray(8, 16))).toBe('ABC')
+    })
+
+    it('should truncate strings longer than the slot length', () => {
+      const buffer = encodeGbaStrings(['ABCDE'], 3)
+      expect(buffer.length).toBe(3)
+      expect(bytesToGbaString(buffer)).toBe('ABC')
+    })
+  })
+
   describe('Config-Specific Functionality', () => {
     it('should handle Quetzal-specific config features', () => {
       expect(quetzalConfig.name).toBe('Pokemon Quetzal')
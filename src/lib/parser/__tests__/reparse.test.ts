@@ -0,0 +1,66 @@
+/**
+ * Tests for the incremental reparse() API
+ * Verifies cached sector state is reused and dirty ranges are re-validated
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { beforeEach, describe, expect, it } from 'vitest'
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import { VanillaConfig } from '../games/vanilla/config'
+
+// Handle ES modules in Node.js
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+describe('PokemonSaveParser.reparse', () => {
+  let parser: PokemonSaveParser
+  let testSaveData: ArrayBuffer
+
+  beforeEach(() => {
+    parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    const savePath = resolve(__dirname, 'test_data', 'emerald.sav')
+    const saveBuffer = readFileSync(savePath)
+    testSaveData = saveBuffer.buffer.slice(
+      saveBuffer.byteOffset,
+      saveBuffer.byteOffset + saveBuffer.byteLength
+    )
+  })
+
+  it('should throw when no save data has been loaded', async () => {
+    await expect(parser.reparse()).rejects.toThrow('Save data and config not loaded')
+  })
+
+  it('should produce the same result as a full parse', async () => {
+    const fullParse = await parser.parse(testSaveData)
+    const reparsed = await parser.reparse()
+
+    expect(reparsed.active_slot).toBe(fullParse.active_slot)
+    expect(reparsed.player_name).toBe(fullParse.player_name)
+    expect(reparsed.party_pokemon.length).toBe(fullParse.party_pokemon.length)
+    reparsed.party_pokemon.forEach((pokemon, i) => {
+      expect(pokemon.speciesId).toBe(fullParse.party_pokemon[i]!.speciesId)
+      expect(pokemon.level).toBe(fullParse.party_pokemon[i]!.level)
+    })
+  })
+
+  it('should reuse cached sector state when no ranges are dirty', async () => {
+    const fullParse = await parser.parse(testSaveData)
+    const reparsed = await parser.reparse([])
+
+    expect(reparsed.active_slot).toBe(fullParse.active_slot)
+    expect(reparsed.sector_map).toBe(fullParse.sector_map)
+    expect(reparsed.party_pokemon.length).toBe(fullParse.party_pokemon.length)
+  })
+
+  it('should re-validate sectors overlapping dirty ranges', async () => {
+    const fullParse = await parser.parse(testSaveData)
+
+    // Mark a single byte dirty in the middle of the save
+    const reparsed = await parser.reparse([{ offset: 5 * 4096 + 100, length: 1 }])
+
+    expect(reparsed.active_slot).toBe(fullParse.active_slot)
+    expect(reparsed.party_pokemon.length).toBe(fullParse.party_pokemon.length)
+  })
+})
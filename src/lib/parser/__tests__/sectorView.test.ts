@@ -0,0 +1,69 @@
+/**
+ * Unit tests for SectorView zero-copy sector views
+ * Verifies zero-copy reads, boundary-crossing assembly, and write-safe copies
+ */
+
+import { describe, expect, it } from 'vitest'
+import { SectorView } from '../core/SectorView'
+
+/** Build a view of two 8-byte chunks backed by one shared buffer */
+function createTwoChunkView() {
+  const backing = new Uint8Array(32)
+  for (let i = 0; i < backing.length; i++) backing[i] = i
+  // Chunks are non-adjacent in the backing buffer (like out-of-order sectors)
+  const view = new SectorView(
+    [
+      { bytes: backing.subarray(16, 24), logicalOffset: 0 },
+      { bytes: backing.subarray(0, 8), logicalOffset: 8 },
+    ],
+    16
+  )
+  return { backing, view }
+}
+
+describe('SectorView', () => {
+  it('should serve reads within a single chunk without copying', () => {
+    const { backing, view } = createTwoChunkView()
+    const bytes = view.getBytes(2, 4)
+    expect([...bytes]).toEqual([18, 19, 20, 21])
+    // Zero-copy: the view aliases the backing buffer
+    expect(bytes.buffer).toBe(backing.buffer)
+  })
+
+  it('should assemble reads that cross chunk boundaries', () => {
+    const { backing, view } = createTwoChunkView()
+    const bytes = view.getBytes(6, 4)
+    expect([...bytes]).toEqual([22, 23, 0, 1])
+    // Boundary-crossing reads materialize a copy
+    expect(bytes.buffer).not.toBe(backing.buffer)
+  })
+
+  it('should return independent copies from slice', () => {
+    const { backing, view } = createTwoChunkView()
+    const copy = view.slice(0, 4)
+    copy[0] = 0xff
+    expect(backing[16]).toBe(16) // Original buffer untouched
+  })
+
+  it('should materialize the full logical block with toUint8Array', () => {
+    const { view } = createTwoChunkView()
+    const full = view.toUint8Array()
+    expect(full.length).toBe(16)
+    expect([...full]).toEqual([16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 3, 4, 5, 6, 7])
+    // Cached: repeated calls return the same materialized buffer
+    expect(view.toUint8Array()).toBe(full)
+  })
+
+  it('should zero-fill ranges not covered by any chunk', () => {
+    const chunk = new Uint8Array([1, 2, 3, 4])
+    const view = new SectorView([{ bytes: chunk, logicalOffset: 4 }], 12)
+    expect([...view.getBytes(0, 12)]).toEqual([0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0])
+  })
+
+  it('should wrap contiguous buffers without copying', () => {
+    const bytes = new Uint8Array([9, 8, 7, 6])
+    const view = SectorView.fromContiguous(bytes)
+    expect(view.byteLength).toBe(4)
+    expect(view.getBytes(1, 2).buffer).toBe(bytes.buffer)
+  })
+})
@@ -0,0 +1,79 @@
+/**
+ * Tests for the memoized stat calculation layer
+ */
+
+import { describe, expect, it } from 'vitest'
+import {
+  calculateSingleStat,
+  calculateTotalStatsDirect,
+  getNatureModifier,
+} from '../core/utils'
+
+// Reference implementation of the Gen 3 stat formulas, kept deliberately
+// independent of the memoized code paths under test
+function referenceStat(
+  statIndex: number,
+  base: number,
+  iv: number,
+  ev: number,
+  level: number,
+  nature: string
+): number {
+  const core = Math.floor(((2 * base + iv + Math.floor(ev / 4)) * level) / 100)
+  if (statIndex === 0) return core + level + 10
+  return Math.floor((core + 5) * getNatureModifier(nature, statIndex))
+}
+
+describe('Memoized stat calculation', () => {
+  const baseStats = [70, 85, 65, 120, 95, 75] // HP, Atk, Def, Spe, SpA, SpD
+  const ivs = [31, 31, 31, 31, 31, 31]
+  const evs = [6, 252, 0, 252, 0, 0]
+
+  it('should match the reference formulas for all six stats', () => {
+    const stats = calculateTotalStatsDirect(baseStats, ivs, evs, 50, 'Jolly')
+    for (let i = 0; i < 6; i++) {
+      expect(stats[i]).toBe(referenceStat(i, baseStats[i]!, ivs[i]!, evs[i]!, 50, 'Jolly'))
+    }
+  })
+
+  it('should return the same frozen array for identical inputs', () => {
+    const first = calculateTotalStatsDirect(baseStats, ivs, evs, 100, 'Adamant')
+    const second = calculateTotalStatsDirect([...baseStats], [...ivs], [...evs], 100, 'Adamant')
+    expect(second).toBe(first)
+    expect(Object.isFrozen(first)).toBe(true)
+  })
+
+  it('should return a different result when a single input changes', () => {
+    const before = calculateTotalStatsDirect(baseStats, ivs, evs, 100, 'Adamant')
+    const after = calculateTotalStatsDirect(baseStats, ivs, [6, 248, 0, 252, 0, 4], 100, 'Adamant')
+    expect(after).not.toBe(before)
+    expect(after[5]).toBe(referenceStat(5, baseStats[5]!, 31, 4, 100, 'Adamant'))
+  })
+
+  it('should compute single stats consistently with the full calculation', () => {
+    const stats = calculateTotalStatsDirect(baseStats, ivs, evs, 78, 'Modest')
+    for (let i = 0; i < 6; i++) {
+      expect(calculateSingleStat(i, baseStats[i]!, ivs[i]!, evs[i]!, 78, 'Modest')).toBe(stats[i])
+    }
+  })
+
+  it('should apply nature modifiers and leave HP neutral', () => {
+    // Adamant: +Atk, -SpA
+    const neutral = calculateSingleStat(1, 100, 31, 252, 100, 'Hardy')
+    const boosted = calculateSingleStat(1, 100, 31, 252, 100, 'Adamant')
+    const reduced = calculateSingleStat(4, 100, 31, 252, 100, 'Adamant')
+    expect(boosted).toBe(Math.floor(neutral * 1.1))
+    expect(reduced).toBe(Math.floor(calculateSingleStat(4, 100, 31, 252, 100, 'Hardy') * 0.9))
+
+    const hpHardy = calculateSingleStat(0, 100, 31, 252, 100, 'Hardy')
+    const hpAdamant = calculateSingleStat(0, 100, 31, 252, 100, 'Adamant')
+    expect(hpAdamant).toBe(hpHardy)
+  })
+
+  it('should handle out-of-range inputs without caching artifacts', () => {
+    // Level 255 exceeds the packable range; must still compute correctly
+    expect(calculateSingleStat(0, 100, 31, 252, 255, 'Hardy')).toBe(
+      referenceStat(0, 100, 31, 252, 255, 'Hardy')
+    )
+  })
+})
@@ -4,6 +4,8 @@
 
 import { describe, test, expect, beforeEach, vi } from 'vitest'
 import { MgbaWebSocketClient } from '../../mgba/websocket-client'
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import { VanillaConfig } from '../games/vanilla/config'
 
 describe('WebSocket Watch Mode Regression Tests', () => {
   let mockWebSocket: {
@@ -156,6 +158,76 @@ describe('WebSocket Watch Mode Regression Tests', () => {
     expect(actualMessage).toBe(expectedMessage)
   })
 
+  describe('Delta-aware watch notifications', () => {
+    type ParserInternals = {
+      config: VanillaConfig
+      webSocketClient: unknown
+      pendingChangedSlots: Set<number>
+      watchFlushTimer: ReturnType<typeof setTimeout> | null
+      handleMemoryChange: (address: number, size: number, data: Uint8Array) => Promise<void>
+    }
+
+    const config = new VanillaConfig()
+    const { partyData, partyCount } = config.memoryAddresses
+    const partyBytes = config.pokemonSize * config.maxPartySize
+
+    const createWatchingParser = () => {
+      const parser = new PokemonSaveParser(undefined, config)
+      const internals = parser as unknown as ParserInternals
+      internals.config = config
+      // Reads reject so scheduled flushes stay pending instead of parsing
+      internals.webSocketClient = { readBytes: vi.fn().mockRejectedValue(new Error('no cache')) }
+      return { parser, internals }
+    }
+
+    test('should mark only slots whose bytes changed', async () => {
+      const { internals } = createWatchingParser()
+
+      // First full-region update primes the shadow copy (all slots changed)
+      const baseline = new Uint8Array(partyBytes)
+      await internals.handleMemoryChange(partyData, partyBytes, baseline)
+      expect([...internals.pendingChangedSlots].sort((a, b) => a - b)).toEqual([0, 1, 2, 3, 4, 5])
+      internals.pendingChangedSlots.clear()
+
+      // Single HP byte tick in slot 2 should only mark slot 2
+      const update = new Uint8Array(baseline)
+      update[2 * config.pokemonSize + 86] = 99
+      await internals.handleMemoryChange(partyData, partyBytes, update)
+      expect([...internals.pendingChangedSlots]).toEqual([2])
+    })
+
+    test('should mark all slots when the party count changes', async () => {
+      const { internals } = createWatchingParser()
+
+      await internals.handleMemoryChange(partyCount, 7, new Uint8Array([3, 0, 0, 0, 0, 0, 0]))
+      expect(internals.pendingChangedSlots.size).toBe(config.maxPartySize)
+
+      // Same count again should not re-mark anything
+      internals.pendingChangedSlots.clear()
+      await internals.handleMemoryChange(partyCount, 7, new Uint8Array([3, 0, 0, 0, 0, 0, 0]))
+      expect(internals.pendingChangedSlots.size).toBe(0)
+    })
+
+    test('should coalesce bursts into a single scheduled flush', async () => {
+      vi.useFakeTimers()
+      try {
+        const { internals } = createWatchingParser()
+        const baseline = new Uint8Array(partyBytes)
+        await internals.handleMemoryChange(partyData, partyBytes, baseline)
+        const firstTimer = internals.watchFlushTimer
+        expect(firstTimer).not.toBeNull()
+
+        // A second burst within the window reuses the pending flush
+        const update = new Uint8Array(baseline)
+        update[0] = 1
+        await internals.handleMemoryChange(partyData, partyBytes, update)
+        expect(internals.watchFlushTimer).toBe(firstTimer)
+      } finally {
+        vi.useRealTimers()
+      }
+    })
+  })
+
   test('should prevent the original "syntax error near 33703145" issue', () => {
     // This is a regression test specifically for the reported error:
     // "❌ Error processing memory change: Failed to read memory: [string "websocket-eval"]:2: syntax error near '33703145'"
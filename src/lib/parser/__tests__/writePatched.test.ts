@@ -0,0 +1,138 @@
+/**
+ * Tests for patched save writes via FileSystemWritableFileStream
+ * Verifies positioned writes only touch sectors that differ from what the
+ * backing file already holds, and that failures keep the shadow stale so a
+ * retry rewrites the lost data
+ */
+
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { beforeEach, describe, expect, it, vi } from 'vitest'
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import { VanillaConfig } from '../games/vanilla/config'
+
+// Handle ES modules in Node.js
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+const SECTOR_SIZE = 4096
+
+interface RecordedWrite {
+  position: number
+  length: number
+}
+
+const createMockHandle = (options: { failWrite?: boolean } = {}) => {
+  const writes: RecordedWrite[] = []
+  const writable = {
+    write: vi.fn(async (params: { type: string; position: number; data: Uint8Array }) => {
+      if (options.failWrite) throw new Error('disk full')
+      writes.push({ position: params.position, length: params.data.length })
+    }),
+    close: vi.fn(async () => {}),
+    abort: vi.fn(async () => {}),
+  }
+  const createWritable = vi.fn(async () => writable)
+  const handle = { createWritable } as unknown as FileSystemFileHandle
+  return { handle, createWritable, writable, writes }
+}
+
+describe('PokemonSaveParser.writePatched', () => {
+  let parser: PokemonSaveParser
+  let saveBytes: Buffer
+
+  beforeEach(() => {
+    parser = new PokemonSaveParser(undefined, new VanillaConfig())
+    saveBytes = readFileSync(resolve(__dirname, 'test_data', 'emerald.sav'))
+  })
+
+  const parseAsFile = async () => {
+    const file = new File([new Uint8Array(saveBytes)], 'emerald.sav')
+    return parser.parse(file)
+  }
+
+  it('should skip the write entirely when nothing changed since loading', async () => {
+    const result = await parseAsFile()
+    const { handle, createWritable } = createMockHandle()
+
+    const bytesWritten = await parser.writePatched(result.party_pokemon, handle)
+    expect(bytesWritten).toBe(0)
+    expect(createWritable).not.toHaveBeenCalled()
+  })
+
+  it('should rewrite only the sectors an edit touched', async () => {
+    const result = await parseAsFile()
+    const pokemon = result.party_pokemon[0]!
+    pokemon.hpEV = pokemon.hpEV === 0 ? 4 : 0
+
+    const { handle, createWritable, writes } = createMockHandle()
+    const bytesWritten = await parser.writePatched(result.party_pokemon, handle)
+
+    expect(createWritable).toHaveBeenCalledWith({ keepExistingData: true })
+    expect(writes.length).toBeGreaterThan(0)
+    expect(writes.length).toBeLessThan(saveBytes.length / SECTOR_SIZE)
+    expect(bytesWritten).toBe(writes.reduce((sum, w) => sum + w.length, 0))
+    for (const write of writes) {
+      expect(write.position % SECTOR_SIZE).toBe(0)
+      expect(write.length).toBeLessThanOrEqual(SECTOR_SIZE)
+    }
+  })
+
+  it('should write every sector when the on-disk contents are unknown', async () => {
+    // ArrayBuffer inputs (e.g. undo/redo) carry no information about the file
+    const result = await parser.parse(
+      saveBytes.buffer.slice(saveBytes.byteOffset, saveBytes.byteOffset + saveBytes.byteLength)
+    )
+    const { handle, writes } = createMockHandle()
+
+    const bytesWritten = await parser.writePatched(result.party_pokemon, handle)
+    expect(bytesWritten).toBe(saveBytes.length)
+    expect(writes.length).toBe(saveBytes.length / SECTOR_SIZE)
+  })
+
+  it('should report the file as synced after a successful patched write', async () => {
+    const result = await parseAsFile()
+    const pokemon = result.party_pokemon[0]!
+    pokemon.hpEV = pokemon.hpEV === 0 ? 4 : 0
+
+    const first = createMockHandle()
+    await parser.writePatched(result.party_pokemon, first.handle)
+
+    // The same party reconstructs identically, so nothing is stale anymore
+    const second = createMockHandle()
+    expect(await parser.writePatched(result.party_pokemon, second.handle)).toBe(0)
+    expect(second.createWritable).not.toHaveBeenCalled()
+  })
+
+  it('should abort the stream on failure and keep the sector stale for retry', async () => {
+    const result = await parseAsFile()
+    const pokemon = result.party_pokemon[0]!
+    pokemon.hpEV = pokemon.hpEV === 0 ? 4 : 0
+
+    const failing = createMockHandle({ failWrite: true })
+    await expect(parser.writePatched(result.party_pokemon, failing.handle)).rejects.toThrow(
+      'disk full'
+    )
+    expect(failing.writable.abort).toHaveBeenCalled()
+    expect(failing.writable.close).not.toHaveBeenCalled()
+
+    // The shadow was not advanced, so a retry writes the sector again
+    const retry = createMockHandle()
+    expect(await parser.writePatched(result.party_pokemon, retry.handle)).toBeGreaterThan(0)
+  })
+
+  it('should honor markFileSynced as a new diff baseline', async () => {
+    const result = await parseAsFile()
+    const pokemon = result.party_pokemon[0]!
+    pokemon.hpEV = pokemon.hpEV === 0 ? 4 : 0
+
+    // A full write (e.g. Save As) syncs the file out-of-band
+    const newSave = parser.reconstructSaveFile(result.party_pokemon)
+    parser.markFileSynced(newSave)
+
+    const { handle, createWritable } = createMockHandle()
+    expect(await parser.writePatched(result.party_pokemon, handle)).toBe(0)
+    expect(createWritable).not.toHaveBeenCalled()
+  })
+})
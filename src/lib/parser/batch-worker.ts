@@ -0,0 +1,73 @@
+/**
+ * Batch parsing worker for the CLI
+ * Loads the game configs and ID mappings once per thread, then parses save
+ * files streamed from the parent thread and posts back NDJSON-ready records
+ */
+import fs from 'fs'
+import { parentPort } from 'worker_threads'
+import { PokemonSaveParser } from './core/PokemonSaveParser'
+
+/** One NDJSON output line for a successfully parsed save file */
+export interface BatchRecord {
+  file: string
+  game: string
+  player_name: string
+  play_time: { hours: number; minutes: number; seconds: number }
+  active_slot: number
+  party: {
+    slot: number
+    speciesId: number
+    nickname: string
+    level: number
+    isShiny: boolean
+  }[]
+}
+
+/** Message posted back to the parent thread for each processed file */
+export type BatchResult =
+  | { ok: true; file: string; record: BatchRecord }
+  | { ok: false; file: string; error: string }
+
+/**
+ * Parse a single save file into an NDJSON-ready record.
+ * Shared by the in-process batch path and the worker-thread path so both
+ * reuse the registry and mappings already loaded in their process/thread.
+ */
+export async function parseSaveToRecord(filePath: string): Promise<BatchRecord> {
+  const parser = new PokemonSaveParser()
+  const buffer = fs.readFileSync(filePath)
+  const result = await parser.parse(
+    buffer.buffer.slice(buffer.byteOffset, buffer.byteOffset + buffer.byteLength)
+  )
+
+  return {
+    file: filePath,
+    game: parser.gameConfig?.name ?? 'unknown',
+    player_name: result.player_name,
+    play_time: result.play_time,
+    active_slot: result.active_slot,
+    party: result.party_pokemon.map((p, i) => ({
+      slot: i + 1,
+      speciesId: p.speciesId,
+      nickname: p.nickname,
+      level: p.level,
+      isShiny: p.isShiny,
+    })),
+  }
+}
+
+// Worker-thread mode: parse each file path streamed from the parent thread.
+// parentPort is null when this module is imported from the main thread.
+parentPort?.on('message', async (filePath: string) => {
+  let result: BatchResult
+  try {
+    result = { ok: true, file: filePath, record: await parseSaveToRecord(filePath) }
+  } catch (error) {
+    result = {
+      ok: false,
+      file: filePath,
+      error: error instanceof Error ? error.message : 'Unknown error',
+    }
+  }
+  parentPort!.postMessage(result)
+})
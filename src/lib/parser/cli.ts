@@ -1,7 +1,10 @@
 #!/usr/bin/env -S npx tsx
 import fs from 'fs'
 import path from 'path'
-import { PokemonSaveParser } from './core/PokemonSaveParser'
+import { fileURLToPath } from 'url'
+import { Worker } from 'worker_threads'
+import { parseSaveToRecord, type BatchResult } from './batch-worker'
+import { PokemonSaveParser, type ParseMetrics } from './core/PokemonSaveParser'
 import type { PokemonBase } from './core/PokemonBase'
 import type { SaveData } from './core/types'
 import { bytesToGbaString, gbaStringToBytes } from './core/utils'
@@ -164,12 +167,123 @@ const displayPartyPokemonGraph = (party: readonly PokemonBase[]) => {
   })
 }
 
+/** Display per-stage parse timings collected with --timing. */
+const displayParseMetrics = (metrics: ParseMetrics) => {
+  console.log('\n--- Parse Timing ---')
+  console.log(`Total: ${metrics.totalMs.toFixed(2)}ms`)
+  for (const [stage, ms] of Object.entries(metrics.stages)) {
+    console.log(`  ${pad(stage, 20)} ${ms.toFixed(2)}ms`)
+  }
+  console.log(
+    `Sectors scanned: ${metrics.sectorsScanned} (cache hits: ${metrics.sectorInfoCacheHits})`
+  )
+  console.log(`Bytes copied: ${metrics.bytesCopied}`)
+}
+
+// Flat per-slot record used for NDJSON streaming; primitive values only so
+// delta frames can diff field by field with plain comparisons
+type SlotRecord = Record<string, string | number>
+
+const serializeSlot = (p: PokemonBase): SlotRecord => ({
+  speciesId: p.speciesId,
+  nickname: p.nickname,
+  level: p.level,
+  currentHp: p.currentHp,
+  maxHp: p.maxHp,
+  status: p.status,
+  nature: p.nature,
+  shiny: p.shinyNumber,
+  attack: p.attack,
+  defense: p.defense,
+  speed: p.speed,
+  spAttack: p.spAttack,
+  spDefense: p.spDefense,
+  otName: p.otName,
+  otId: p.otId_str,
+})
+
+/**
+ * NDJSON frame writer for watch mode: one full snapshot frame up front, then
+ * per-change delta frames (changed slots, changed fields only). Backpressure
+ * from a slow downstream pipe is honored via the stdout write() return value:
+ * while the pipe is full, updates collapse into the latest party state, and
+ * drain emits a single coalesced snapshot instead of a backlog of deltas.
+ */
+class NdjsonPartyStreamer {
+  private seq = 0
+  private lastSlots: SlotRecord[] = []
+  private blocked = false
+  private pendingParty: readonly PokemonBase[] | null = null
+
+  constructor() {
+    process.stdout.on('drain', () => {
+      this.blocked = false
+      if (this.pendingParty) {
+        const party = this.pendingParty
+        this.pendingParty = null
+        this.emitSnapshot(party, true)
+      }
+    })
+  }
+
+  /** Emit a full party frame (initial state, resyncs, post-backpressure) */
+  emitSnapshot(party: readonly PokemonBase[], coalesced = false): void {
+    this.lastSlots = party.map(serializeSlot)
+    this.writeFrame({
+      type: 'snapshot',
+      seq: this.seq++,
+      at: Date.now(),
+      ...(coalesced ? { coalesced: true } : {}),
+      party: this.lastSlots,
+    })
+  }
+
+  /** Emit a delta frame for the slots/fields that changed since the last frame */
+  update(party: readonly PokemonBase[]): void {
+    if (this.blocked) {
+      // Slow consumer: keep only the newest state, drain will snapshot it
+      this.pendingParty = party
+      return
+    }
+
+    // Party size changes (capture, release, reorder) resync with a snapshot
+    if (party.length !== this.lastSlots.length) {
+      this.emitSnapshot(party)
+      return
+    }
+
+    const changed: { slot: number; fields: SlotRecord }[] = []
+    const nextSlots = party.map(serializeSlot)
+    for (let slot = 0; slot < nextSlots.length; slot++) {
+      const previous = this.lastSlots[slot]!
+      const current = nextSlots[slot]!
+      const fields: SlotRecord = {}
+      let dirty = false
+      for (const key of Object.keys(current)) {
+        if (current[key] !== previous[key]) {
+          fields[key] = current[key]!
+          dirty = true
+        }
+      }
+      if (dirty) changed.push({ slot, fields })
+    }
+
+    this.lastSlots = nextSlots
+    if (changed.length === 0) return
+    this.writeFrame({ type: 'delta', seq: this.seq++, at: Date.now(), changed })
+  }
+
+  private writeFrame(frame: Record<string, unknown>): void {
+    this.blocked = !process.stdout.write(`${JSON.stringify(frame)}\n`)
+  }
+}
+
 /**
  * Parse and display save data from either file or WebSocket
  */
 async function parseAndDisplay(
   input: string | MgbaWebSocketClient,
-  options: { debug: boolean; graph: boolean; skipDisplay?: boolean }
+  options: { debug: boolean; graph: boolean; timing?: boolean; skipDisplay?: boolean }
 ): Promise<SaveData> {
   const parser = new PokemonSaveParser()
   let result: SaveData
@@ -208,11 +322,143 @@ async function parseAndDisplay(
       if (options.debug) displayPartyPokemonRaw(result.party_pokemon)
       displaySaveblock2Info(result, mode)
     }
+
+    if (options.timing) {
+      const metrics = parser.getLastParseMetrics()
+      if (metrics) displayParseMetrics(metrics)
+    }
   }
 
   return result
 }
 
+/**
+ * Collect save files for batch mode: every .sav under a directory (recursive),
+ * or the paths listed in a manifest file (one per line, relative to the manifest)
+ */
+function collectBatchFiles(target: string): string[] {
+  const absTarget = path.resolve(target)
+  if (fs.statSync(absTarget).isDirectory()) {
+    const files: string[] = []
+    const walk = (dir: string) => {
+      for (const entry of fs.readdirSync(dir, { withFileTypes: true })) {
+        const fullPath = path.join(dir, entry.name)
+        if (entry.isDirectory()) walk(fullPath)
+        else if (/\.sav$/i.test(entry.name)) files.push(fullPath)
+      }
+    }
+    walk(absTarget)
+    return files.sort()
+  }
+
+  const manifestDir = path.dirname(absTarget)
+  return fs
+    .readFileSync(absTarget, 'utf8')
+    .split('\n')
+    .map(line => line.trim())
+    .filter(Boolean)
+    .map(line => path.resolve(manifestDir, line))
+}
+
+/**
+ * Fan batch files out across worker threads, streaming NDJSON results as they
+ * complete. Each worker loads the configs and ID mappings exactly once.
+ * Resolves with the number of files that failed to parse.
+ */
+function runBatchWorkers(files: string[], jobs: number): Promise<number> {
+  return new Promise((resolve, reject) => {
+    const workerPath = fileURLToPath(new URL('./batch-worker.ts', import.meta.url))
+    const queue = [...files]
+    const workers: Worker[] = []
+    let active = 0
+    let failures = 0
+
+    const shutdown = () => {
+      for (const worker of workers) void worker.terminate()
+    }
+
+    for (let i = 0; i < Math.min(jobs, files.length); i++) {
+      const worker = new Worker(workerPath)
+      workers.push(worker)
+
+      const assignNext = () => {
+        const file = queue.shift()
+        if (file === undefined) {
+          if (active === 0) {
+            shutdown()
+            resolve(failures)
+          }
+          return
+        }
+        active++
+        worker.postMessage(file)
+      }
+
+      worker.on('message', (result: BatchResult) => {
+        active--
+        if (result.ok) {
+          console.log(JSON.stringify(result.record))
+        } else {
+          failures++
+          console.log(JSON.stringify({ file: result.file, error: result.error }))
+        }
+        assignNext()
+      })
+
+      worker.on('error', error => {
+        shutdown()
+        reject(error)
+      })
+
+      assignNext()
+    }
+  })
+}
+
+/**
+ * Batch mode - parse many save files in one process, emitting one NDJSON
+ * record per file on stdout (progress and summary go to stderr)
+ */
+async function runBatchMode(target: string, jobs: number): Promise<void> {
+  if (!target || !fs.existsSync(path.resolve(target))) {
+    console.error('❌ Batch target not found:', target)
+    process.exit(1)
+  }
+
+  const files = collectBatchFiles(target)
+  if (!files.length) {
+    console.error('❌ No .sav files found in batch target:', target)
+    process.exit(1)
+  }
+
+  console.error(`🗂  Parsing ${files.length} save file(s) with ${jobs} job(s)...`)
+  const started = Date.now()
+  let failures = 0
+
+  if (jobs <= 1) {
+    // In-process streaming: configs and mappings are loaded once, files parsed sequentially
+    for (const file of files) {
+      try {
+        console.log(JSON.stringify(await parseSaveToRecord(file)))
+      } catch (error) {
+        failures++
+        console.log(
+          JSON.stringify({
+            file,
+            error: error instanceof Error ? error.message : 'Unknown error',
+          })
+        )
+      }
+    }
+  } else {
+    failures = await runBatchWorkers(files, jobs)
+  }
+
+  const elapsed = Date.now() - started
+  console.error(`✅ Parsed ${files.length - failures}/${files.length} file(s) in ${elapsed}ms`)
+  process.exit(failures > 0 ? 1 : 0)
+}
+
 /**
  * Clear screen and move cursor to top
  */
@@ -225,7 +471,7 @@ function clearScreen() {
  */
 async function watchMode(
   input: string | MgbaWebSocketClient,
-  options: { debug: boolean; graph: boolean; interval: number }
+  options: { debug: boolean; graph: boolean; interval: number; format: 'table' | 'ndjson' }
 ) {
   if (typeof input === 'string') {
     // File-based watch mode - use polling since files don't support push notifications
@@ -241,13 +487,17 @@ async function watchMode(
  */
 async function watchModeFile(
   filePath: string,
-  options: { debug: boolean; graph: boolean; interval: number }
+  options: { debug: boolean; graph: boolean; interval: number; format: 'table' | 'ndjson' }
 ) {
-  console.log(`🔄 Starting file watch mode (updating every ${options.interval}ms)...`)
-  console.log('Press Ctrl+C to exit')
+  const ndjson = options.format === 'ndjson'
+  // In NDJSON mode stdout is the data stream; status goes to stderr
+  const status = ndjson ? console.error : console.log
+  status(`🔄 Starting file watch mode (updating every ${options.interval}ms)...`)
+  status('Press Ctrl+C to exit')
 
   // Create parser once and reuse it
   const parser = new PokemonSaveParser()
+  const streamer = ndjson ? new NdjsonPartyStreamer() : null
   let lastDataHash = ''
   let isFirstRun = true
 
@@ -259,23 +509,32 @@ async function watchModeFile(
       const buffer = fs.readFileSync(absPath)
       const result = await parser.parse(buffer)
 
-      // Create a simple hash of the party data to detect changes
-      const dataHash = JSON.stringify(
-        result.party_pokemon.map(p => ({
-          species: p.speciesId,
-          level: p.level,
-          hp: p.currentHp,
-          nickname: p.nickname,
-        }))
-      )
-
-      // Only update display if party data changed or first run
-      if (dataHash !== lastDataHash || isFirstRun) {
-        clearScreen()
-        displayPartyPokemon(result.party_pokemon, 'FILE')
-
-        lastDataHash = dataHash
-        isFirstRun = false
+      if (streamer) {
+        if (isFirstRun) {
+          streamer.emitSnapshot(result.party_pokemon)
+          isFirstRun = false
+        } else {
+          streamer.update(result.party_pokemon)
+        }
+      } else {
+        // Create a simple hash of the party data to detect changes
+        const dataHash = JSON.stringify(
+          result.party_pokemon.map(p => ({
+            species: p.speciesId,
+            level: p.level,
+            hp: p.currentHp,
+            nickname: p.nickname,
+          }))
+        )
+
+        // Only update display if party data changed or first run
+        if (dataHash !== lastDataHash || isFirstRun) {
+          clearScreen()
+          displayPartyPokemon(result.party_pokemon, 'FILE')
+
+          lastDataHash = dataHash
+          isFirstRun = false
+        }
       }
     } catch (error) {
       console.error('❌ Error:', error instanceof Error ? error.message : 'Unknown error')
@@ -290,34 +549,46 @@ async function watchModeFile(
  */
 async function watchModeWebSocket(
   client: MgbaWebSocketClient,
-  options: { debug: boolean; graph: boolean; interval: number }
+  options: { debug: boolean; graph: boolean; interval: number; format: 'table' | 'ndjson' }
 ) {
-  console.log('🔄 Starting event-driven watch mode...')
-  console.log('Press Ctrl+C to exit')
+  const ndjson = options.format === 'ndjson'
+  // In NDJSON mode stdout is the data stream; status goes to stderr
+  const status = ndjson ? console.error : console.log
+  status('🔄 Starting event-driven watch mode...')
+  status('Press Ctrl+C to exit')
 
   // Create parser once and reuse it
   const parser = new PokemonSaveParser()
+  const streamer = ndjson ? new NdjsonPartyStreamer() : null
 
   // Load the WebSocket client into memory mode
   await parser.loadInputData(client)
 
   // Get and display initial data
   const initialData = await parser.getCurrentSaveData()
-  displayPartyPokemon(initialData.party_pokemon, 'MEMORY')
-  if (options.debug) displayPartyPokemonRaw(initialData.party_pokemon)
+  if (streamer) {
+    streamer.emitSnapshot(initialData.party_pokemon)
+  } else {
+    displayPartyPokemon(initialData.party_pokemon, 'MEMORY')
+    if (options.debug) displayPartyPokemonRaw(initialData.party_pokemon)
+  }
 
   // Set up watching with the new parser API
   await parser.watch({
-    onPartyChange: partyPokemon => {
+    onPartyChange: ({ party }) => {
+      if (streamer) {
+        streamer.update(party)
+        return
+      }
       clearScreen()
-      displayPartyPokemon(partyPokemon, 'MEMORY')
-      if (options.debug) displayPartyPokemonRaw(partyPokemon)
+      displayPartyPokemon(party, 'MEMORY')
+      if (options.debug) displayPartyPokemonRaw(party)
     },
     onError: error => {
       console.error('❌ Error processing memory change:', error.message)
     },
   })
-  console.log('✅ Memory watching started')
+  status('✅ Memory watching started')
 
   // Keep the process alive and handle cleanup
   return new Promise<void>(resolve => {
@@ -340,15 +611,34 @@ async function main() {
   const graph = argv.includes('--graph')
   const watch = argv.includes('--watch')
   const websocket = argv.includes('--websocket')
+  const timing = argv.includes('--timing')
+  if (timing) PokemonSaveParser.setMetricsEnabled(true)
 
   // Watch interval option
   const intervalArg = argv.find(arg => arg.startsWith('--interval='))
   const interval = intervalArg ? parseInt(intervalArg.split('=')[1] ?? '1000') : 1000
 
+  // Watch output format (table display or machine-consumable NDJSON stream)
+  const formatArg = argv.find(arg => arg.startsWith('--format='))
+  const format = formatArg?.split('=')[1] === 'ndjson' ? ('ndjson' as const) : ('table' as const)
+  if (formatArg && format === 'table' && formatArg !== '--format=table') {
+    console.error(`❌ Unknown format: ${formatArg.split('=')[1]} (expected table or ndjson)`)
+    process.exit(1)
+  }
+
   // WebSocket URL option
   const wsUrlArg = argv.find(arg => arg.startsWith('--ws-url='))
   const wsUrl = wsUrlArg ? wsUrlArg.split('=')[1] : 'ws://localhost:7102/ws'
 
+  // Batch mode: parse many saves in one process, emitting NDJSON
+  const batchArg = argv.find(arg => arg.startsWith('--batch='))
+  if (batchArg) {
+    const jobsArg = argv.find(arg => arg.startsWith('--jobs='))
+    const jobs = Math.max(1, parseInt(jobsArg?.split('=')[1] ?? '1') || 1)
+    await runBatchMode(batchArg.split('=')[1] ?? '', jobs)
+    return
+  }
+
   // Utility string conversion functions
   const toBytesArg = argv.find(arg => arg.startsWith('--toBytes='))
   if (toBytesArg) {
@@ -382,13 +672,14 @@ async function main() {
   let input: string | MgbaWebSocketClient
 
   if (websocket) {
-    // WebSocket mode
-    console.log(`🔌 Connecting to mGBA WebSocket at ${wsUrl}...`)
+    // WebSocket mode (status to stderr in NDJSON mode; stdout carries frames)
+    const status = format === 'ndjson' ? console.error : console.log
+    status(`🔌 Connecting to mGBA WebSocket at ${wsUrl}...`)
     const client = new MgbaWebSocketClient(wsUrl)
 
     try {
       await client.connect()
-      console.log('✅ Connected successfully!')
+      status('✅ Connected successfully!')
       input = client
 
       // Setup cleanup on exit
@@ -413,16 +704,22 @@ Options:
   --websocket           Connect to mGBA via WebSocket instead of reading a file
   --ws-url=URL          WebSocket URL (default: ws://localhost:7102/ws)
   --watch               Continuously monitor for changes and update display
+  --format=FORMAT       Watch output: table (default) or ndjson (snapshot frame, then per-change deltas on stdout)
   --interval=MS         Update interval in milliseconds for watch mode (default: 1000)
   --debug               Show raw bytes for each party Pokémon after the summary table
+  --timing              Show per-stage parse timings and sector-scan statistics
   --graph               Show colored hex/field graph for each party Pokémon (instead of summary table)
   --toBytes=STRING      Convert a string to GBA byte encoding and print the result
   --toString=HEX        Convert a space/comma-separated hex byte string to a decoded GBA string
+  --batch=PATH          Parse every .sav under a directory (or listed in a manifest file) and emit NDJSON
+  --jobs=N              Worker threads for batch mode (default: 1, in-process)
 
 Examples:
   tsx cli.ts mysave.sav --debug
   tsx cli.ts mysave.sav --graph --watch
+  tsx cli.ts --batch=./saves --jobs=8 > results.ndjson
   tsx cli.ts --websocket --watch --interval=2000
+  tsx cli.ts --websocket --watch --format=ndjson | overlay-consumer
   tsx cli.ts --websocket --debug
   tsx cli.ts --toBytes=PIKACHU
   tsx cli.ts --toString="50 49 4b 41 43 48 55 00"
@@ -436,7 +733,7 @@ WebSocket Mode:
   }
 
   // Parse options
-  const options = { debug, graph, interval }
+  const options = { debug, graph, interval, timing, format }
 
   try {
     if (watch) {
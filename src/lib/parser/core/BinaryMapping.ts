@@ -0,0 +1,263 @@
+/**
+ * Compact binary ID mapping tables
+ * Stores mapping entries as typed-array columns (keys, external IDs, string
+ * table offsets) over a shared UTF-8 string table instead of one boxed object
+ * per entry. Implements the ReadonlyMap interface used by GameConfig.mappings,
+ * decoding entries lazily on first access.
+ *
+ * Tables can be built directly from the JSON map data at runtime, or compiled
+ * ahead of time to .bin files via scripts/generate-binary-mappings.ts and
+ * loaded with BinaryMapping.load (fetch in the browser, readFile in Node).
+ */
+
+import type { BaseMappingItem } from './utils'
+
+/** Magic bytes 'PKMB' identifying a compiled mapping table */
+const BINARY_MAPPING_MAGIC = 0x424d4b50
+const BINARY_MAPPING_VERSION = 1
+const HEADER_BYTES = 16
+
+const textEncoder = new TextEncoder()
+const textDecoder = new TextDecoder()
+
+export class BinaryMapping<T extends BaseMappingItem = BaseMappingItem>
+  implements ReadonlyMap<number, T>
+{
+  // Memoized decoded entries, indexed by column position
+  private readonly decodedEntries: (T | undefined)[]
+
+  private constructor(
+    private readonly keyColumn: Uint32Array,
+    private readonly idColumn: Int32Array,
+    private readonly nameOffsets: Uint32Array,
+    private readonly nameLengths: Uint32Array,
+    private readonly idNameOffsets: Uint32Array,
+    private readonly idNameLengths: Uint32Array,
+    private readonly stringTable: Uint8Array
+  ) {
+    this.decodedEntries = new Array<T | undefined>(keyColumn.length)
+  }
+
+  /**
+   * Build a binary table from raw JSON mapping data (same input shape as
+   * createMapping, entries with a null id are dropped)
+   */
+  static fromJson<T extends BaseMappingItem = BaseMappingItem>(
+    mapData: Record<string, unknown>
+  ): BinaryMapping<T> {
+    const entries = Object.entries(mapData)
+      .filter(
+        (pair): pair is [string, BaseMappingItem] =>
+          typeof pair[1] === 'object' && pair[1] !== null && 'id' in pair[1] && pair[1].id !== null
+      )
+      .map(([k, v]) => [parseInt(k, 10), v] as const)
+      .sort((a, b) => a[0] - b[0])
+
+    const count = entries.length
+    const keys = new Uint32Array(count)
+    const ids = new Int32Array(count)
+    const nameOffsets = new Uint32Array(count)
+    const nameLengths = new Uint32Array(count)
+    const idNameOffsets = new Uint32Array(count)
+    const idNameLengths = new Uint32Array(count)
+
+    const stringChunks: Uint8Array[] = []
+    let stringTableLength = 0
+    const appendString = (value: string): { offset: number; length: number } => {
+      const bytes = textEncoder.encode(value)
+      const offset = stringTableLength
+      stringChunks.push(bytes)
+      stringTableLength += bytes.length
+      return { offset, length: bytes.length }
+    }
+
+    entries.forEach(([key, entry], i) => {
+      keys[i] = key
+      ids[i] = entry.id ?? -1
+      const name = appendString(entry.name)
+      nameOffsets[i] = name.offset
+      nameLengths[i] = name.length
+      const idName = appendString(entry.id_name)
+      idNameOffsets[i] = idName.offset
+      idNameLengths[i] = idName.length
+    })
+
+    const stringTable = new Uint8Array(stringTableLength)
+    let position = 0
+    for (const chunk of stringChunks) {
+      stringTable.set(chunk, position)
+      position += chunk.length
+    }
+
+    return new BinaryMapping<T>(
+      keys,
+      ids,
+      nameOffsets,
+      nameLengths,
+      idNameOffsets,
+      idNameLengths,
+      stringTable
+    )
+  }
+
+  /**
+   * Serialize the table to the compact binary format
+   */
+  encode(): Uint8Array {
+    const count = this.keyColumn.length
+    const columnBytes = count * 4 * 6
+    const output = new Uint8Array(HEADER_BYTES + columnBytes + this.stringTable.length)
+    const view = new DataView(output.buffer)
+
+    view.setUint32(0, BINARY_MAPPING_MAGIC, true)
+    view.setUint32(4, BINARY_MAPPING_VERSION, true)
+    view.setUint32(8, count, true)
+    view.setUint32(12, this.stringTable.length, true)
+
+    const columns = [
+      new Uint32Array(this.keyColumn),
+      new Uint32Array(this.idColumn.map(id => id >>> 0)),
+      this.nameOffsets,
+      this.nameLengths,
+      this.idNameOffsets,
+      this.idNameLengths,
+    ]
+    let offset = HEADER_BYTES
+    for (const column of columns) {
+      output.set(new Uint8Array(column.buffer, column.byteOffset, column.byteLength), offset)
+      offset += count * 4
+    }
+    output.set(this.stringTable, offset)
+
+    return output
+  }
+
+  /**
+   * Parse a table from the compact binary format
+   */
+  static decode<T extends BaseMappingItem = BaseMappingItem>(bytes: Uint8Array): BinaryMapping<T> {
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength)
+    if (bytes.length < HEADER_BYTES || view.getUint32(0, true) !== BINARY_MAPPING_MAGIC) {
+      throw new Error('Invalid binary mapping table: bad magic')
+    }
+    const version = view.getUint32(4, true)
+    if (version !== BINARY_MAPPING_VERSION) {
+      throw new Error(`Unsupported binary mapping version: ${version}`)
+    }
+    const count = view.getUint32(8, true)
+    const stringTableLength = view.getUint32(12, true)
+
+    // Copy columns out so they are 4-byte aligned regardless of source offset
+    const column = (index: number) => {
+      const start = bytes.byteOffset + HEADER_BYTES + index * count * 4
+      return new Uint32Array(bytes.buffer.slice(start, start + count * 4))
+    }
+
+    const stringsStart = HEADER_BYTES + count * 4 * 6
+    return new BinaryMapping<T>(
+      column(0),
+      new Int32Array(column(1).buffer),
+      column(2),
+      column(3),
+      column(4),
+      column(5),
+      bytes.subarray(stringsStart, stringsStart + stringTableLength)
+    )
+  }
+
+  /**
+   * Load a compiled .bin table: readFile in Node, fetch in the browser
+   */
+  static async load<T extends BaseMappingItem = BaseMappingItem>(
+    source: string
+  ): Promise<BinaryMapping<T>> {
+    if (typeof window === 'undefined' && typeof process !== 'undefined') {
+      const { readFile } = await import('fs/promises')
+      const buffer = await readFile(source)
+      return BinaryMapping.decode<T>(
+        new Uint8Array(buffer.buffer, buffer.byteOffset, buffer.byteLength)
+      )
+    }
+
+    const response = await fetch(source)
+    if (!response.ok) {
+      throw new Error(`Failed to load binary mapping from ${source}: ${response.status}`)
+    }
+    return BinaryMapping.decode<T>(new Uint8Array(await response.arrayBuffer()))
+  }
+
+  get size(): number {
+    return this.keyColumn.length
+  }
+
+  get(key: number): T | undefined {
+    const index = this.indexOf(key)
+    return index === -1 ? undefined : this.decodeEntry(index)
+  }
+
+  has(key: number): boolean {
+    return this.indexOf(key) !== -1
+  }
+
+  forEach(
+    callbackfn: (value: T, key: number, map: ReadonlyMap<number, T>) => void,
+    thisArg?: unknown
+  ): void {
+    for (let i = 0; i < this.keyColumn.length; i++) {
+      callbackfn.call(thisArg, this.decodeEntry(i), this.keyColumn[i]!, this)
+    }
+  }
+
+  *entries(): IterableIterator<[number, T]> {
+    for (let i = 0; i < this.keyColumn.length; i++) {
+      yield [this.keyColumn[i]!, this.decodeEntry(i)]
+    }
+  }
+
+  *keys(): IterableIterator<number> {
+    for (let i = 0; i < this.keyColumn.length; i++) {
+      yield this.keyColumn[i]!
+    }
+  }
+
+  *values(): IterableIterator<T> {
+    for (let i = 0; i < this.keyColumn.length; i++) {
+      yield this.decodeEntry(i)
+    }
+  }
+
+  [Symbol.iterator](): IterableIterator<[number, T]> {
+    return this.entries()
+  }
+
+  /** Binary search the sorted key column */
+  private indexOf(key: number): number {
+    let low = 0
+    let high = this.keyColumn.length - 1
+    while (low <= high) {
+      const mid = (low + high) >>> 1
+      const candidate = this.keyColumn[mid]!
+      if (candidate === key) return mid
+      if (candidate < key) low = mid + 1
+      else high = mid - 1
+    }
+    return -1
+  }
+
+  /** Decode (and memoize) the boxed entry for a column index */
+  private decodeEntry(index: number): T {
+    const cached = this.decodedEntries[index]
+    if (cached) return cached
+
+    const readString = (offset: number, length: number) =>
+      textDecoder.decode(this.stringTable.subarray(offset, offset + length))
+
+    const entry = {
+      id: this.idColumn[index]! === -1 ? null : this.idColumn[index]!,
+      name: readString(this.nameOffsets[index]!, this.nameLengths[index]!),
+      id_name: readString(this.idNameOffsets[index]!, this.idNameLengths[index]!),
+    } as T
+    this.decodedEntries[index] = entry
+    return entry
+  }
+}
@@ -0,0 +1,136 @@
+/**
+ * Lazy PC box storage built on top of the sector views.
+ * The Gen-III PokemonStorage struct (sectors 5-13) carries 14 boxes of 30
+ * 80-byte BoxPokemon entries; decoding all 420 up front would dominate parse
+ * time, so boxes are decoded on demand and cached, and box tabs can be
+ * rendered from cheap species-ID summaries that never touch full decoding.
+ *
+ * Layout follows the vanilla Emerald PokemonStorage struct; ROM hacks that
+ * relocate or restructure box storage are not yet supported here.
+ */
+
+import type { GameConfig } from './types'
+import { createPokemon } from './PokemonAccessors'
+import type { PokemonBase } from './PokemonBase'
+import type { SectorView } from './SectorView'
+
+export const BOX_COUNT = 14
+export const POKEMON_PER_BOX = 30
+
+/** BoxPokemon struct size; party structs add 20 battle-stat bytes on top */
+export const BOX_POKEMON_SIZE = 80
+
+/** boxes[][] start inside PokemonStorage (u8 currentBox + alignment padding) */
+const STORAGE_BOXES_OFFSET = 4
+
+// Position of the Growth substruct (which holds the species id) for each
+// personality % 24, mirroring PokemonBase.getSubstructOrder first column
+const GROWTH_POSITION = [
+  0, 0, 0, 0, 0, 0, 1, 1, 2, 3, 2, 3, 1, 1, 2, 3, 2, 3, 1, 1, 2, 3, 2, 3,
+] as const
+
+export class BoxStorage {
+  // Decoded boxes and header summaries, both filled on first access
+  private readonly decodedBoxes = new Map<number, (PokemonBase | null)[]>()
+  private readonly summaries = new Map<number, readonly number[]>()
+
+  constructor(
+    private readonly storage: SectorView,
+    private readonly config: GameConfig
+  ) {}
+
+  /** Index of the box the player last had open in-game */
+  get currentBoxIndex(): number {
+    return this.storage.getBytes(0, 1)[0] ?? 0
+  }
+
+  get boxCount(): number {
+    return BOX_COUNT
+  }
+
+  get pokemonPerBox(): number {
+    return POKEMON_PER_BOX
+  }
+
+  private boxOffset(boxIndex: number): number {
+    if (boxIndex < 0 || boxIndex >= BOX_COUNT) {
+      throw new Error(`Box index must be 0-${BOX_COUNT - 1}, got ${boxIndex}`)
+    }
+    return STORAGE_BOXES_OFFSET + boxIndex * POKEMON_PER_BOX * BOX_POKEMON_SIZE
+  }
+
+  /**
+   * Species ids for each of the 30 slots in a box (0 for empty slots).
+   * Only the personality, OT id and one XOR-decrypted word per entry are
+   * read, so scanning all 14 summaries stays cheap enough for tab rendering.
+   */
+  getBoxSummary(boxIndex: number): readonly number[] {
+    const cached = this.summaries.get(boxIndex)
+    if (cached) return cached
+
+    const boxStart = this.boxOffset(boxIndex)
+    const species: number[] = []
+    for (let slot = 0; slot < POKEMON_PER_BOX; slot++) {
+      const entry = this.storage.getBytes(boxStart + slot * BOX_POKEMON_SIZE, BOX_POKEMON_SIZE)
+      const view = new DataView(entry.buffer, entry.byteOffset, entry.byteLength)
+      const personality = view.getUint32(0, true)
+      const otId = view.getUint32(4, true)
+      if (personality === 0 && otId === 0) {
+        species.push(0)
+        continue
+      }
+      // Species is the first u16 of the Growth substruct; decrypt just that word
+      const growthOffset = 0x20 + GROWTH_POSITION[personality % 24]! * 12
+      const rawSpecies = (view.getUint32(growthOffset, true) ^ personality ^ otId) & 0xffff
+      species.push(this.config.mappings?.pokemon?.get(rawSpecies)?.id ?? rawSpecies)
+    }
+
+    const summary = Object.freeze(species) as readonly number[]
+    this.summaries.set(boxIndex, summary)
+    return summary
+  }
+
+  /**
+   * Decode a box's 30 entries as PokemonBase instances (null for empty
+   * slots), caching the result. Box entries are padded to the configured
+   * party struct size so the usual accessors work; party-only fields
+   * (level, battle stats) read as zero for boxed Pokemon.
+   */
+  getBox(boxIndex: number): (PokemonBase | null)[] {
+    const cached = this.decodedBoxes.get(boxIndex)
+    if (cached) return cached
+
+    const boxStart = this.boxOffset(boxIndex)
+    const summary = this.getBoxSummary(boxIndex)
+    const pokemonSize = typeof this.config.pokemonSize === 'number' ? this.config.pokemonSize : 100
+
+    const box: (PokemonBase | null)[] = []
+    for (let slot = 0; slot < POKEMON_PER_BOX; slot++) {
+      if (summary[slot] === 0) {
+        box.push(null)
+        continue
+      }
+      const data = new Uint8Array(pokemonSize)
+      data.set(
+        this.storage.getBytes(
+          boxStart + slot * BOX_POKEMON_SIZE,
+          Math.min(BOX_POKEMON_SIZE, pokemonSize)
+        )
+      )
+      try {
+        box.push(createPokemon(data, this.config))
+      } catch {
+        box.push(null)
+      }
+    }
+
+    this.decodedBoxes.set(boxIndex, box)
+    return box
+  }
+
+  /** Drop cached decodes, e.g. after the underlying save bytes changed */
+  clearCache(): void {
+    this.decodedBoxes.clear()
+    this.summaries.clear()
+  }
+}
@@ -2,7 +2,87 @@
  * Base class for game configurations with common functionality
  */
 
-import { VANILLA_EMERALD_SIGNATURE } from './types'
+import { VANILLA_EMERALD_SIGNATURE, type DetectionContext } from './types'
+
+/**
+ * Scan all 32 sector footers and the slot counters once, producing the
+ * shared DetectionContext that detection hands to every registered config.
+ * SaveBlock1 extraction is deferred and cached since only configs that
+ * survive the pre-screen need actual Pokemon bytes.
+ */
+export function buildDetectionContext(
+  saveData: Uint8Array,
+  expectedSignature: number = VANILLA_EMERALD_SIGNATURE
+): DetectionContext {
+  const size = saveData.length
+  const saveSizeValid = size >= 131072 && size <= 131200
+
+  interface FooterInfo {
+    sectorId: number
+    counter: number
+    valid: boolean
+  }
+  const footers: FooterInfo[] = []
+  let validSignatureCount = 0
+  for (let i = 0; i < 32; i++) {
+    const footerOffset = i * 4096 + 4096 - 12
+    if (footerOffset + 12 > saveData.length) {
+      footers.push({ sectorId: -1, counter: 0, valid: false })
+      continue
+    }
+    const view = new DataView(saveData.buffer, saveData.byteOffset + footerOffset, 12)
+    const valid = view.getUint32(4, true) === expectedSignature
+    if (valid) validSignatureCount++
+    footers.push({
+      sectorId: valid ? view.getUint16(0, true) : -1,
+      counter: valid ? view.getUint16(8, true) : 0,
+      valid,
+    })
+  }
+
+  const counterSum = (start: number) => {
+    let sum = 0
+    for (let i = start; i < start + 18 && i < footers.length; i++) {
+      sum += footers[i]!.counter
+    }
+    return sum
+  }
+  const activeSlot = counterSum(14) >= counterSum(0) ? 14 : 0
+
+  const sectorMap = new Map<number, number>()
+  for (let i = activeSlot; i < activeSlot + 18 && i < footers.length; i++) {
+    const footer = footers[i]!
+    if (footer.valid) {
+      sectorMap.set(footer.sectorId, i)
+    }
+  }
+
+  let saveBlock1: Uint8Array | null = null
+  let saveBlock1Attempted = false
+
+  return {
+    saveData,
+    saveSizeValid,
+    validSignatureCount,
+    hasEmeraldSignature: saveSizeValid && validSignatureCount >= 8,
+    activeSlot,
+    sectorMap,
+    getSaveBlock1: () => {
+      if (saveBlock1Attempted) return saveBlock1
+      saveBlock1Attempted = true
+      const saveblock1Sectors = [1, 2, 3, 4].filter(id => sectorMap.has(id))
+      if (saveblock1Sectors.length === 0) return null
+      const data = new Uint8Array(3968 * 4)
+      for (const sectorId of saveblock1Sectors) {
+        const sectorIdx = sectorMap.get(sectorId)!
+        const startOffset = sectorIdx * 4096
+        data.set(saveData.subarray(startOffset, startOffset + 3968), (sectorId - 1) * 3968)
+      }
+      saveBlock1 = data
+      return saveBlock1
+    },
+  }
+}
 
 /**
  * Abstract base class providing common functionality for all game configurations
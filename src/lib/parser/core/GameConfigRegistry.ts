@@ -1,52 +1,244 @@
 /**
  * Game configuration registry for automatic game detection
+ *
+ * Games can be registered eagerly (a constructor, loaded with the app) or
+ * lazily (a lightweight detection descriptor whose full config module and
+ * mapping data are pulled in via dynamic import() only after detection picks
+ * a winner). The web app registers every game lazily so visitors never
+ * download mapping tables for games they are not playing.
  */
 
-import type { GameConfig } from './types'
+import type { DetectionContext, GameConfig } from './types'
+import { buildDetectionContext } from './GameConfigBase'
+import { getPokemonClass } from './PokemonAccessors'
 
 /**
  * Type for game config constructors that can be registered
  */
 export type GameConfigConstructor = new () => GameConfig
 
+/**
+ * Lightweight detection stub for a lazily-loaded game config. Carries only
+ * the structural checks needed to pick a winner; load() dynamically imports
+ * the full config module together with its mapping data.
+ */
+export interface LazyGameConfigDescriptor {
+  /** Must match the `name` of the config instance produced by load() */
+  readonly name: string
+  /** Cheap shared-fact check deciding whether the trial parse is worth running */
+  readonly preScreen?: (context: DetectionContext) => boolean
+  /** Structural trial parse against the shared detection facts */
+  readonly canHandleWithContext: (context: DetectionContext) => boolean
+  /** Memory-mode detection from the emulator's game title */
+  readonly canHandleMemory?: (gameTitle: string) => boolean
+  /** Dynamic import of the full config module */
+  readonly load: () => Promise<GameConfig>
+}
+
+interface EagerEntry {
+  kind: 'eager'
+  configClass: GameConfigConstructor
+}
+
+interface LazyEntry {
+  kind: 'lazy'
+  descriptor: LazyGameConfigDescriptor
+  loaded: GameConfig | null
+  loading: Promise<GameConfig> | null
+}
+
+type RegistryEntry = EagerEntry | LazyEntry
+
 /**
  * Registry for game configurations with automatic detection
  */
 export class GameConfigRegistry {
-  private readonly configs: GameConfigConstructor[] = []
+  // Registration (priority) order is preserved across eager and lazy entries
+  private readonly entries: RegistryEntry[] = []
 
   /**
-   * Register a game configuration class
+   * Register a game configuration class (eager; config and data ship with
+   * the registering bundle)
    */
   register(configClass: GameConfigConstructor): void {
-    this.configs.push(configClass)
+    this.entries.push({ kind: 'eager', configClass })
+    // Build the config's specialized Pokemon accessor class up front so the
+    // first parse doesn't pay for it
+    try {
+      getPokemonClass(new configClass())
+    } catch {
+      // Configs that cannot be instantiated here still get their class lazily
+    }
+  }
+
+  /**
+   * Register a game through its detection descriptor; the full config module
+   * is imported only when detection picks it (or loadByName asks for it)
+   */
+  registerLazy(descriptor: LazyGameConfigDescriptor): void {
+    this.entries.push({ kind: 'lazy', descriptor, loaded: null, loading: null })
+  }
+
+  private loadEntry(entry: LazyEntry): Promise<GameConfig> {
+    if (entry.loaded) return Promise.resolve(entry.loaded)
+    if (!entry.loading) {
+      entry.loading = entry.descriptor.load().then(config => {
+        entry.loaded = config
+        // Same accessor warmup the eager path gets at registration time
+        try {
+          getPokemonClass(config)
+        } catch {}
+        return config
+      })
+      // A failed import stays retryable instead of caching the rejection
+      entry.loading.catch(() => {
+        entry.loading = null
+      })
+    }
+    return entry.loading
+  }
+
+  /** Config instance usable for synchronous detection, if one exists yet */
+  private instantiate(entry: RegistryEntry): GameConfig | null {
+    if (entry.kind === 'lazy') return entry.loaded
+    try {
+      return new entry.configClass()
+    } catch {
+      return null
+    }
+  }
+
+  /**
+   * Auto-detect the appropriate game configuration, loading the winning
+   * config module on demand. This is the full detection path; the synchronous
+   * detectGameConfig can only see configs that are already loaded.
+   */
+  resolveConfig(saveData: Uint8Array): Promise<GameConfig | null>
+  resolveConfig(gameTitle: string): Promise<GameConfig | null>
+  async resolveConfig(input: Uint8Array | string): Promise<GameConfig | null> {
+    // Memory mode: check game titles directly, no save image to pre-screen
+    if (typeof input === 'string') {
+      for (const entry of this.entries) {
+        try {
+          const instance = this.instantiate(entry)
+          if (instance) {
+            if (instance.canHandleMemory?.(input)) return instance
+          } else if (entry.kind === 'lazy' && entry.descriptor.canHandleMemory?.(input)) {
+            return await this.loadEntry(entry)
+          }
+        } catch {
+          continue
+        }
+      }
+      return null
+    }
+
+    // File mode: scan sector footers and slot counters once, then walk the
+    // entries in priority order -- pre-screen from the shared facts, trial
+    // parse survivors, and import the first winner's full module
+    const context = buildDetectionContext(input)
+    for (const entry of this.entries) {
+      try {
+        const instance = this.instantiate(entry)
+        if (instance) {
+          if (instance.preScreen && !instance.preScreen(context)) continue
+          const handled = instance.canHandleWithContext
+            ? instance.canHandleWithContext(context)
+            : instance.canHandle(input)
+          if (handled) return instance
+        } else if (entry.kind === 'lazy') {
+          const { descriptor } = entry
+          if (descriptor.preScreen && !descriptor.preScreen(context)) continue
+          if (descriptor.canHandleWithContext(context)) return await this.loadEntry(entry)
+        }
+      } catch {
+        continue
+      }
+    }
+    return null
   }
 
   /**
-   * Auto-detect the appropriate game configuration for save data or memory
+   * Load a config by its name, importing its module if necessary. Used to
+   * materialize a config on this thread when another thread (e.g. the parse
+   * worker) already ran detection and reported the winner's name.
+   */
+  async loadByName(name: string): Promise<GameConfig | null> {
+    for (const entry of this.entries) {
+      try {
+        const instance = this.instantiate(entry)
+        if (instance?.name === name) return instance
+        if (entry.kind === 'lazy' && entry.descriptor.name === name) {
+          return await this.loadEntry(entry)
+        }
+      } catch {
+        continue
+      }
+    }
+    return null
+  }
+
+  /** Synchronous by-name lookup over eager and already-loaded configs */
+  findLoadedByName(name: string): GameConfig | null {
+    for (const entry of this.entries) {
+      try {
+        const instance = this.instantiate(entry)
+        if (instance?.name === name) return instance
+      } catch {
+        continue
+      }
+    }
+    return null
+  }
+
+  /**
+   * Synchronous detection over eager and already-loaded configs. Configs
+   * registered lazily that have not been imported yet cannot win here; use
+   * resolveConfig for the complete set.
    */
   detectGameConfig(saveData: Uint8Array): GameConfig | null
   detectGameConfig(gameTitle: string): GameConfig | null
   detectGameConfig(input: Uint8Array | string): GameConfig | null {
-    // Try each registered config in order
-    for (const ConfigClass of this.configs) {
-      try {
-        const config = new ConfigClass()
-
-        // Check if input is save data (Uint8Array) or game title (string)
-        if (typeof input === 'string') {
-          // Memory mode: check if config can handle this game title
-          if (config.canHandleMemory?.(input)) {
-            return config
-          }
-        } else {
-          // File mode: check if config can handle this save data
-          if (config.canHandle(input)) {
+    // Memory mode: check game titles directly, no save image to pre-screen
+    if (typeof input === 'string') {
+      for (const entry of this.entries) {
+        try {
+          const config = this.instantiate(entry)
+          if (config?.canHandleMemory?.(input)) {
             return config
           }
+        } catch {
+          continue
+        }
+      }
+      return null
+    }
+
+    // File mode, phase 1: scan sector footers and slot counters once, then
+    // let each config rule itself out from the shared facts without paying
+    // for a trial parse
+    const context = buildDetectionContext(input)
+    const candidates: GameConfig[] = []
+    for (const entry of this.entries) {
+      try {
+        const config = this.instantiate(entry)
+        if (config && (!config.preScreen || config.preScreen(context))) {
+          candidates.push(config)
+        }
+      } catch {
+        // If config creation or pre-screening fails, continue to next
+        continue
+      }
+    }
+
+    // Phase 2: only surviving candidates attempt an actual trial parse,
+    // still in registration (most specific first) order
+    for (const config of candidates) {
+      try {
+        if (config.canHandleWithContext ? config.canHandleWithContext(context) : config.canHandle(input)) {
+          return config
         }
       } catch {
-        // If config creation or detection fails, continue to next
         continue
       }
     }
@@ -55,17 +247,23 @@ export class GameConfigRegistry {
   }
 
   /**
-   * Get all registered config classes (for testing/debugging)
+   * Get all registered config classes (for testing/debugging). Lazy entries
+   * appear only once their module has been loaded.
    */
   getRegisteredConfigs(): readonly GameConfigConstructor[] {
-    return [...this.configs]
+    const classes: GameConfigConstructor[] = []
+    for (const entry of this.entries) {
+      if (entry.kind === 'eager') classes.push(entry.configClass)
+      else if (entry.loaded) classes.push(entry.loaded.constructor as GameConfigConstructor)
+    }
+    return classes
   }
 
   /**
    * Clear all registered configs (for testing)
    */
   clear(): void {
-    this.configs.length = 0
+    this.entries.length = 0
   }
 }
 
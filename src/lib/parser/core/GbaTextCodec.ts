@@ -0,0 +1,130 @@
+/**
+ * Unified GBA text codec with flat lookup tables
+ *
+ * Both decode paths used to live apart (decodePokemonText in the parser,
+ * bytesToGbaString in utils) with object-keyed charmap lookups per byte.
+ * This module builds a 256-entry flat decode array and its reverse encode
+ * map once from pokemon_charmap.json, so per-character work is a single
+ * indexed load — which matters once PC boxes decode hundreds of nicknames
+ * and OT names per save.
+ * See: https://bulbapedia.bulbagarden.net/wiki/Character_encoding_in_Generation_III
+ */
+
+import charmapData from '../data/pokemon_charmap.json'
+
+/** End-of-string marker in the GBA character encoding */
+export const GBA_TEXT_TERMINATOR = 0xff
+
+// Flat decode table: index = byte value, '' = unmapped or control code.
+// Charmap control sequences are normalized at build time ('\n' literal for
+// line breaks, dropped '\l'/'\p') so the decode loop is pure concatenation.
+const DECODE_TABLE: string[] = new Array<string>(256).fill('')
+const ENCODE_TABLE = new Map<string, number>()
+
+for (const [key, value] of Object.entries(charmapData as Record<string, string>)) {
+  const byte = parseInt(key, 10)
+  if (!Number.isInteger(byte) || byte < 0 || byte > 255) continue
+  DECODE_TABLE[byte] = value === '\\n' ? '\n' : value === '\\l' || value === '\\p' ? '' : value
+  ENCODE_TABLE.set(value, byte)
+}
+
+/**
+ * Decode one string, stopping at the 0xFF terminator. Unmapped bytes and
+ * control codes contribute nothing.
+ */
+export function decodeGbaText(bytes: Uint8Array, start = 0, end = bytes.length): string {
+  let result = ''
+  for (let i = start; i < end; i++) {
+    const byte = bytes[i]!
+    if (byte === GBA_TEXT_TERMINATOR) break
+    result += DECODE_TABLE[byte]
+  }
+  return result.trim()
+}
+
+/**
+ * Decode a pre-bounded range without treating 0xFF as a terminator (used
+ * after heuristic end detection, where stray fill bytes may sit inside the
+ * kept range and should simply be skipped)
+ */
+export function decodeGbaTextLenient(bytes: Uint8Array, start = 0, end = bytes.length): string {
+  let result = ''
+  for (let i = start; i < end; i++) {
+    result += DECODE_TABLE[bytes[i]!]
+  }
+  return result.trim()
+}
+
+/**
+ * Find the end of a GBA string by detecting 0xFF padding and garbage
+ * patterns (names copied from memory are not always cleanly terminated)
+ */
+export function findGbaStringEnd(bytes: Uint8Array): number {
+  // Check for trailing 0xFF padding (more than 2 suggests padding)
+  let trailingFFs = 0
+  for (let i = bytes.length - 1; i >= 0 && bytes[i] === GBA_TEXT_TERMINATOR; i--) {
+    trailingFFs++
+  }
+
+  if (trailingFFs > 2) {
+    return bytes.length - trailingFFs
+  }
+
+  // Look for garbage pattern: 0xFF followed by low values (0x01-0x0F)
+  for (let i = 0; i < bytes.length - 1; i++) {
+    if (bytes[i] === GBA_TEXT_TERMINATOR) {
+      for (let j = i + 1; j < bytes.length; j++) {
+        const nextByte = bytes[j]!
+        if (nextByte > 0 && nextByte < 0x10) return i // Found garbage
+        if (nextByte !== GBA_TEXT_TERMINATOR && nextByte !== 0) break
+      }
+    }
+  }
+
+  return bytes.length
+}
+
+/**
+ * Decode many fixed-width strings from one buffer in a single pass, e.g.
+ * every nickname in a PC storage block. Entry i spans
+ * [offset + i * stride, offset + i * stride + width).
+ *
+ * @param buffer Source bytes holding the packed strings
+ * @param stride Distance between consecutive entries
+ * @param count Number of entries to decode
+ * @param options.offset Start of the first entry (default 0)
+ * @param options.width Bytes to read per entry (default stride)
+ */
+export function decodeGbaTextAll(
+  buffer: Uint8Array,
+  stride: number,
+  count: number,
+  options: { offset?: number; width?: number } = {}
+): string[] {
+  const offset = options.offset ?? 0
+  const width = options.width ?? stride
+  const result = new Array<string>(count)
+  for (let i = 0; i < count; i++) {
+    const start = offset + i * stride
+    result[i] = decodeGbaText(buffer, start, Math.min(start + width, buffer.length))
+  }
+  return result
+}
+
+/**
+ * Encode a string into an existing buffer at the given offset using the
+ * shared reverse table. The target region must already be 0xFF-padded by
+ * the caller; unmapped characters encode as 0x00.
+ */
+export function encodeGbaTextInto(
+  str: string,
+  target: Uint8Array,
+  offset: number,
+  length: number
+): void {
+  let i = 0
+  for (const char of str) {
+    if (i >= length) break
+    target[offset + i++] = ENCODE_TABLE.get(char) ?? 0x00
+  }
+}
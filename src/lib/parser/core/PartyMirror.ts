@@ -0,0 +1,200 @@
+/**
+ * SharedArrayBuffer-backed live party mirror for watch mode
+ *
+ * The watch pipeline (WebSocket client in a worker) publishes the canonical
+ * party bytes into a shared buffer; consumers on other threads read them
+ * through ordinary PokemonBase views without any postMessage copies. A
+ * seqlock-style generation counter (odd while a write is in progress,
+ * bumped to the next even value when it completes) lets readers detect
+ * updates and torn reads with plain Atomics operations.
+ */
+
+import { createPokemon } from './PokemonAccessors'
+import type { PokemonBase } from './PokemonBase'
+import type { GameConfig } from './types'
+
+/** Int32 header slots preceding the party bytes */
+const HEADER = {
+  /** Seqlock generation: odd = write in progress, even = stable */
+  GENERATION: 0,
+  /** Number of valid party slots in the current generation */
+  PARTY_COUNT: 1,
+  /** Bytes per party slot, for sanity-checking attach() against a config */
+  POKEMON_SIZE: 2,
+  /** Total slots the buffer was sized for */
+  MAX_PARTY_SIZE: 3,
+} as const
+
+const HEADER_INTS = 4
+const HEADER_BYTES = HEADER_INTS * Int32Array.BYTES_PER_ELEMENT
+
+type AtomicsWaitAsync = (
+  typedArray: Int32Array,
+  index: number,
+  value: number,
+  timeout?: number
+) => { async: false; value: 'not-equal' | 'timed-out' } | { async: true; value: Promise<string> }
+
+/**
+ * One shared party region with a writer side (publish) and a reader side
+ * (live views, consistent snapshots, change waiting). Create the writer with
+ * PartyMirror.create, transfer `buffer` once via postMessage, and attach
+ * readers with PartyMirror.attach.
+ */
+export class PartyMirror {
+  private readonly header: Int32Array
+  private readonly partyBytes: Uint8Array
+  // Live zero-copy views over the shared slots, built on first access
+  private readonly slotViews: (PokemonBase | null)[]
+
+  private constructor(
+    public readonly buffer: SharedArrayBuffer,
+    private readonly config: GameConfig
+  ) {
+    this.header = new Int32Array(buffer, 0, HEADER_INTS)
+    this.partyBytes = new Uint8Array(buffer, HEADER_BYTES)
+    this.slotViews = new Array<PokemonBase | null>(config.maxPartySize).fill(null)
+  }
+
+  /**
+   * Whether shared memory is available (requires cross-origin isolation in
+   * browsers; always available in Node)
+   */
+  static isSupported(): boolean {
+    return typeof SharedArrayBuffer !== 'undefined'
+  }
+
+  /**
+   * Allocate a shared party region sized for the given game config
+   */
+  static create(config: GameConfig): PartyMirror {
+    const buffer = new SharedArrayBuffer(HEADER_BYTES + config.maxPartySize * config.pokemonSize)
+    const mirror = new PartyMirror(buffer, config)
+    Atomics.store(mirror.header, HEADER.POKEMON_SIZE, config.pokemonSize)
+    Atomics.store(mirror.header, HEADER.MAX_PARTY_SIZE, config.maxPartySize)
+    return mirror
+  }
+
+  /**
+   * Attach to a shared party region created on another thread
+   */
+  static attach(buffer: SharedArrayBuffer, config: GameConfig): PartyMirror {
+    const header = new Int32Array(buffer, 0, HEADER_INTS)
+    const pokemonSize = Atomics.load(header, HEADER.POKEMON_SIZE)
+    const maxPartySize = Atomics.load(header, HEADER.MAX_PARTY_SIZE)
+    if (pokemonSize !== config.pokemonSize || maxPartySize !== config.maxPartySize) {
+      throw new Error(
+        `Party mirror layout mismatch: buffer holds ${maxPartySize}x${pokemonSize} bytes, ` +
+          `config expects ${config.maxPartySize}x${config.pokemonSize}`
+      )
+    }
+    return new PartyMirror(buffer, config)
+  }
+
+  /**
+   * Generation of the last completed publish (even; 0 before the first one)
+   */
+  get generation(): number {
+    return Atomics.load(this.header, HEADER.GENERATION)
+  }
+
+  /**
+   * Party slot count of the current generation
+   */
+  get partyCount(): number {
+    return Atomics.load(this.header, HEADER.PARTY_COUNT)
+  }
+
+  /**
+   * Writer side: copy the party's canonical bytes into the shared region and
+   * advance the generation. Slots beyond the party length are zeroed so stale
+   * Pokemon never linger after a release or withdraw.
+   */
+  publish(party: readonly PokemonBase[]): void {
+    const { pokemonSize, maxPartySize } = this.config
+    const count = Math.min(party.length, maxPartySize)
+
+    Atomics.add(this.header, HEADER.GENERATION, 1) // odd: write in progress
+    for (let slot = 0; slot < count; slot++) {
+      this.partyBytes.set(party[slot]!.rawBytes.subarray(0, pokemonSize), slot * pokemonSize)
+    }
+    this.partyBytes.fill(0, count * pokemonSize)
+    Atomics.store(this.header, HEADER.PARTY_COUNT, count)
+    Atomics.add(this.header, HEADER.GENERATION, 1) // even: stable
+    Atomics.notify(this.header, HEADER.GENERATION)
+  }
+
+  /**
+   * Reader side: zero-copy PokemonBase views over the live shared slots, one
+   * per current party member. Unencrypted fields (HP, level, status) always
+   * read the latest published bytes; values can change mid-read when the
+   * writer publishes concurrently, which is fine for display use (HP bars).
+   * Encrypted substruct fields are decrypted once and cached per view, and
+   * snapshot() should be used when a consistent party image is required.
+   */
+  readParty(): PokemonBase[] {
+    const { pokemonSize } = this.config
+    const party: PokemonBase[] = []
+    for (let slot = 0; slot < this.partyCount; slot++) {
+      this.slotViews[slot] ??= createPokemon(
+        this.partyBytes.subarray(slot * pokemonSize, (slot + 1) * pokemonSize),
+        this.config
+      )
+      party.push(this.slotViews[slot]!)
+    }
+    return party
+  }
+
+  /**
+   * Reader side: copy out a torn-free party image, retrying while a write is
+   * in progress (seqlock read)
+   */
+  snapshot(): { generation: number; party: PokemonBase[] } {
+    const copy = new Uint8Array(this.partyBytes.length)
+    let generation = 0
+    let count = 0
+    for (;;) {
+      const before = Atomics.load(this.header, HEADER.GENERATION)
+      if ((before & 1) === 0) {
+        copy.set(this.partyBytes)
+        count = Atomics.load(this.header, HEADER.PARTY_COUNT)
+        if (Atomics.load(this.header, HEADER.GENERATION) === before) {
+          generation = before
+          break
+        }
+      }
+    }
+
+    const { pokemonSize } = this.config
+    const party: PokemonBase[] = []
+    for (let slot = 0; slot < count; slot++) {
+      party.push(
+        createPokemon(copy.subarray(slot * pokemonSize, (slot + 1) * pokemonSize), this.config)
+      )
+    }
+    return { generation, party }
+  }
+
+  /**
+   * Resolve when the generation moves past lastGeneration, or after timeoutMs.
+   * Uses Atomics.waitAsync where available (Chrome, Node) and falls back to
+   * frame-rate polling elsewhere. Returns whether a change was observed.
+   */
+  async waitForChange(lastGeneration: number, timeoutMs = 1000): Promise<boolean> {
+    if (this.generation !== lastGeneration) return true
+
+    const { waitAsync } = Atomics as unknown as { waitAsync?: AtomicsWaitAsync }
+    if (waitAsync) {
+      const result = waitAsync(this.header, HEADER.GENERATION, lastGeneration, timeoutMs)
+      const value = result.async ? await result.value : result.value
+      return value !== 'timed-out'
+    }
+
+    const deadline = Date.now() + timeoutMs
+    while (Date.now() < deadline) {
+      await new Promise(resolve => setTimeout(resolve, 16))
+      if (this.generation !== lastGeneration) return true
+    }
+    return this.generation !== lastGeneration
+  }
+}
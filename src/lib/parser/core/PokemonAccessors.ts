@@ -0,0 +1,102 @@
+/**
+ * Per-config specialized Pokemon classes with baked-in field offsets
+ *
+ * PokemonBase getters resolve this.offsets.<field> per access, and when
+ * saves from several games are open in one session those lookups (and the
+ * shared getter functions) go polymorphic for V8's inline caches. Each
+ * game config gets one subclass here whose unencrypted-field accessors are
+ * fresh function objects closing over the layout offsets as constants, so
+ * bulk decode paths (box scanning, batch CLI) compile to fixed-offset
+ * typed reads. Built without eval/new Function to stay CSP-safe.
+ */
+
+import { PokemonBase } from './PokemonBase'
+import { VANILLA_POKEMON_OFFSETS, type GameConfig } from './types'
+
+type PokemonClass = new (data: Uint8Array, config: GameConfig) => PokemonBase
+
+// Accessors need the protected internals of PokemonBase
+type PokemonInternals = { view: DataView; markDirty(): void }
+
+// One specialized class per config class; configs are re-instantiated on
+// every detection, so keying by instance would mint endless classes
+const classByConfigClass = new WeakMap<Function, PokemonClass>()
+
+function defineBakedAccessors(
+  proto: object,
+  offsets: typeof VANILLA_POKEMON_OFFSETS
+): void {
+  const u32 = (offset: number) => ({
+    configurable: true,
+    get(this: PokemonBase) {
+      return (this as unknown as PokemonInternals).view.getUint32(offset, true)
+    },
+  })
+  const u16 = (offset: number) => ({
+    configurable: true,
+    get(this: PokemonBase) {
+      return (this as unknown as PokemonInternals).view.getUint16(offset, true)
+    },
+  })
+  const u16Writable = (offset: number) => ({
+    configurable: true,
+    get(this: PokemonBase) {
+      return (this as unknown as PokemonInternals).view.getUint16(offset, true)
+    },
+    set(this: PokemonBase, value: number) {
+      const internals = this as unknown as PokemonInternals
+      internals.markDirty()
+      internals.view.setUint16(offset, value, true)
+    },
+  })
+  const u8 = (offset: number) => ({
+    configurable: true,
+    get(this: PokemonBase) {
+      return (this as unknown as PokemonInternals).view.getUint8(offset)
+    },
+  })
+
+  Object.defineProperties(proto, {
+    personality: u32(offsets.personality),
+    otId: u32(offsets.otId),
+    currentHp: u16(offsets.currentHp),
+    status: u8(offsets.status),
+    level: u8(offsets.level),
+    maxHp: u16Writable(offsets.maxHp),
+    attack: u16Writable(offsets.attack),
+    defense: u16Writable(offsets.defense),
+    speed: u16Writable(offsets.speed),
+    spAttack: u16Writable(offsets.spAttack),
+    spDefense: u16Writable(offsets.spDefense),
+  })
+}
+
+/**
+ * Get (building on first use) the specialized Pokemon class for a config.
+ * Ad-hoc object-literal configs fall back to plain PokemonBase, since they
+ * share a constructor and cannot be told apart for caching.
+ */
+export function getPokemonClass(config: GameConfig): PokemonClass {
+  const key = config.constructor
+  if (key === Object) return PokemonBase
+
+  let specialized = classByConfigClass.get(key)
+  if (!specialized) {
+    class SpecializedPokemon extends PokemonBase {}
+    defineBakedAccessors(SpecializedPokemon.prototype, {
+      ...VANILLA_POKEMON_OFFSETS,
+      ...config.offsetOverrides,
+    })
+    specialized = SpecializedPokemon
+    classByConfigClass.set(key, specialized)
+  }
+  return specialized
+}
+
+/**
+ * Construct a Pokemon through the config's specialized class
+ */
+export function createPokemon(data: Uint8Array, config: GameConfig): PokemonBase {
+  const SpecializedClass = getPokemonClass(config)
+  return new SpecializedClass(data, config)
+}
@@ -12,6 +12,36 @@ import {
 } from './types'
 import { bytesToGbaString, natureEffects, natures, statStrings } from './utils'
 
+// Shared per-config-class merges of the vanilla defaults with a config's
+// overrides: every Pokemon built for a config reuses one frozen object
+// instead of re-spreading per instance, which also keeps this.offsets
+// monomorphic for V8 inline caches. Ad-hoc object-literal configs share a
+// constructor and get an uncached merge.
+const offsetsByConfigClass = new WeakMap<Function, typeof VANILLA_POKEMON_OFFSETS>()
+const layoutByConfigClass = new WeakMap<Function, typeof VANILLA_SAVE_LAYOUT>()
+
+function mergedOffsets(config: GameConfig): typeof VANILLA_POKEMON_OFFSETS {
+  const key = config.constructor
+  if (key === Object) return { ...VANILLA_POKEMON_OFFSETS, ...config.offsetOverrides }
+  let merged = offsetsByConfigClass.get(key)
+  if (!merged) {
+    merged = Object.freeze({ ...VANILLA_POKEMON_OFFSETS, ...config.offsetOverrides })
+    offsetsByConfigClass.set(key, merged)
+  }
+  return merged
+}
+
+function mergedSaveLayout(config: GameConfig): typeof VANILLA_SAVE_LAYOUT {
+  const key = config.constructor
+  if (key === Object) return { ...VANILLA_SAVE_LAYOUT, ...config.saveLayoutOverrides }
+  let merged = layoutByConfigClass.get(key)
+  if (!merged) {
+    merged = Object.freeze({ ...VANILLA_SAVE_LAYOUT, ...config.saveLayoutOverrides })
+    layoutByConfigClass.set(key, merged)
+  }
+  return merged
+}
+
 /**
  * Pokemon data class with vanilla Pokemon Emerald as the baseline
  * Game configs provide minimal overrides for different games
@@ -22,13 +52,22 @@ export class PokemonBase {
   protected readonly offsets: typeof VANILLA_POKEMON_OFFSETS
   protected readonly saveLayout: typeof VANILLA_SAVE_LAYOUT
 
+  // Decrypted-substruct cache: each of the four substructs is decrypted at
+  // most once into a slot of a pooled 48-byte buffer and served from there.
+  // A slot is invalidated only when its substruct is re-encrypted.
+  private readonly substructCache: (Uint8Array | null)[] = [null, null, null, null]
+  private substructPool: Uint8Array | null = null
+
+  // Set by every mutating setter so save reconstruction can skip clean slots
+  private dirtyFlag = false
+
   constructor(
     protected readonly data: Uint8Array,
     config: GameConfig
   ) {
-    // Merge config overrides with vanilla defaults
-    this.offsets = { ...VANILLA_POKEMON_OFFSETS, ...config.offsetOverrides }
-    this.saveLayout = { ...VANILLA_SAVE_LAYOUT, ...config.saveLayoutOverrides }
+    // Merge config overrides with vanilla defaults (shared per config class)
+    this.offsets = mergedOffsets(config)
+    this.saveLayout = mergedSaveLayout(config)
     // Use a safe fallback when pokemonSize is not provided in config
     const pokemonSize = typeof config.pokemonSize === 'number' ? config.pokemonSize : 100
 
@@ -39,6 +78,24 @@ export class PokemonBase {
     this.config = config
   }
 
+  /**
+   * Whether any setter mutated this Pokemon's data since the last clearDirty()
+   */
+  get isDirty(): boolean {
+    return this.dirtyFlag
+  }
+
+  /**
+   * Reset the mutation flag once changes have been flushed to a save buffer
+   */
+  clearDirty(): void {
+    this.dirtyFlag = false
+  }
+
+  protected markDirty(): void {
+    this.dirtyFlag = true
+  }
+
   // Basic unencrypted properties (common to all games)
   get personality() {
     return this.view.getUint32(this.offsets.personality, true)
@@ -59,36 +116,42 @@ export class PokemonBase {
     return this.view.getUint16(this.offsets.maxHp, true)
   }
   set maxHp(value) {
+    this.markDirty()
     this.view.setUint16(this.offsets.maxHp, value, true)
   }
   get attack() {
     return this.view.getUint16(this.offsets.attack, true)
   }
   set attack(value) {
+    this.markDirty()
     this.view.setUint16(this.offsets.attack, value, true)
   }
   get defense() {
     return this.view.getUint16(this.offsets.defense, true)
   }
   set defense(value) {
+    this.markDirty()
     this.view.setUint16(this.offsets.defense, value, true)
   }
   get speed() {
     return this.view.getUint16(this.offsets.speed, true)
   }
   set speed(value) {
+    this.markDirty()
     this.view.setUint16(this.offsets.speed, value, true)
   }
   get spAttack() {
     return this.view.getUint16(this.offsets.spAttack, true)
   }
   set spAttack(value) {
+    this.markDirty()
     this.view.setUint16(this.offsets.spAttack, value, true)
   }
   get spDefense() {
     return this.view.getUint16(this.offsets.spDefense, true)
   }
   set spDefense(value) {
+    this.markDirty()
     this.view.setUint16(this.offsets.spDefense, value, true)
   }
 
@@ -168,28 +231,44 @@ export class PokemonBase {
       const origView = new DataView(this.data.buffer, this.data.byteOffset + substructOffset + i, 4)
       origView.setUint32(0, encrypted, true)
     }
+
+    // Invalidate only the written substruct; it is re-decrypted on next access
+    this.substructCache[substructIndex] = null
   }
 
   protected getDecryptedSubstruct(data: Uint8Array, substructIndex: number): Uint8Array {
+    // Serve reads of this Pokemon's own data from the cache
+    if (data === this.data) {
+      const cached = this.substructCache[substructIndex]
+      if (cached) return cached
+
+      this.substructPool ??= new Uint8Array(48)
+      const target = this.substructPool.subarray(substructIndex * 12, substructIndex * 12 + 12)
+      this.decryptSubstructInto(data, substructIndex, target)
+      this.substructCache[substructIndex] = target
+      return target
+    }
+
+    // Foreign buffers (e.g. detection helpers) bypass the cache
+    const decryptedData = new Uint8Array(12)
+    this.decryptSubstructInto(data, substructIndex, decryptedData)
+    return decryptedData
+  }
+
+  private decryptSubstructInto(data: Uint8Array, substructIndex: number, target: Uint8Array): void {
     const view = new DataView(data.buffer, data.byteOffset, data.byteLength)
     const personality = view.getUint32(0x00, true)
     const order = this.getSubstructOrder(personality)
     const actualIndex = order[substructIndex]!
     const substructOffset = 0x20 + actualIndex * 12
-    const encryptedData = new Uint8Array(data.buffer, data.byteOffset + substructOffset, 12)
-    const decryptedData = new Uint8Array(12)
+
+    const encView = new DataView(data.buffer, data.byteOffset + substructOffset, 12)
+    const decView = new DataView(target.buffer, target.byteOffset, 12)
 
     const key = this.getEncryptionKey(data)
     for (let i = 0; i < 12; i += 4) {
-      const encView = new DataView(encryptedData.buffer, encryptedData.byteOffset + i, 4)
-      const encrypted = encView.getUint32(0, true)
-      const decrypted = encrypted ^ key
-
-      const decView = new DataView(decryptedData.buffer, i, 4)
-      decView.setUint32(0, decrypted, true)
+      decView.setUint32(i, encView.getUint32(i, true) ^ key, true)
     }
-
-    return decryptedData
   }
 
   // Game-specific data access with config overrides or vanilla defaults
@@ -349,6 +428,7 @@ export class PokemonBase {
   }
 
   set hpEV(value) {
+    this.markDirty()
     if (this.config.setEV) {
       this.config.setEV(this.data, this.view, 0, value)
     } else {
@@ -367,6 +447,7 @@ export class PokemonBase {
   }
 
   set atkEV(value) {
+    this.markDirty()
     if (this.config.setEV) {
       this.config.setEV(this.data, this.view, 1, value)
     } else {
@@ -384,6 +465,7 @@ export class PokemonBase {
   }
 
   set defEV(value) {
+    this.markDirty()
     if (this.config.setEV) {
       this.config.setEV(this.data, this.view, 2, value)
     } else {
@@ -401,6 +483,7 @@ export class PokemonBase {
   }
 
   set speEV(value) {
+    this.markDirty()
     if (this.config.setEV) {
       this.config.setEV(this.data, this.view, 3, value)
     } else {
@@ -418,6 +501,7 @@ export class PokemonBase {
   }
 
   set spaEV(value) {
+    this.markDirty()
     if (this.config.setEV) {
       this.config.setEV(this.data, this.view, 4, value)
     } else {
@@ -435,6 +519,7 @@ export class PokemonBase {
   }
 
   set spdEV(value) {
+    this.markDirty()
     if (this.config.setEV) {
       this.config.setEV(this.data, this.view, 5, value)
     } else {
@@ -461,6 +546,7 @@ export class PokemonBase {
   }
 
   set ivs(values: readonly number[]) {
+    this.markDirty()
     if (this.config.setIVs) {
       this.config.setIVs(this.data, this.view, values)
     } else {
@@ -541,6 +627,8 @@ export class PokemonBase {
       throw new Error(`Nature value must be between 0 and 24, got ${value}`)
     }
 
+    this.markDirty()
+
     if (this.config.setNature) {
       this.config.setNature(this.data, this.view, value)
     } else {
@@ -606,6 +694,7 @@ export class PokemonBase {
   }
 
   set abilityNumber(value: number) {
+    this.markDirty()
     // Clamp to [0,2] and update encoded bits in status byte while preserving other flags
     const clamped = Math.max(0, Math.min(2, value | 0))
     const statusOffset = this.offsets.status
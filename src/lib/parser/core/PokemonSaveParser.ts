@@ -8,35 +8,68 @@ import {
   type PlayTimeData,
   type SaveData,
   type SectorInfo,
+  type WorkerParseSnapshot,
   VANILLA_EMERALD_SIGNATURE,
 } from './types'
 
 import { MgbaWebSocketClient } from '../../mgba/websocket-client'
 import { GameConfigRegistry } from '../games'
+import { BoxStorage } from './BoxStorage'
+import { PartyMirror } from './PartyMirror'
+import { createPokemon } from './PokemonAccessors'
 import { PokemonBase } from './PokemonBase'
+import { SectorView } from './SectorView'
 
-// Import character map for decoding text
-import charMap from '../data/pokemon_charmap.json'
+// Shared flat-table text codec (terminator-aware decode for player names)
+import { decodeGbaText } from './GbaTextCodec'
 
 /**
- * Decode Pokemon character-encoded text to string
+ * Watch mode notification payload: the freshly parsed party plus the slot
+ * indices whose backing memory actually changed since the last notification
  */
-function decodePokemonText(bytes: Uint8Array): string {
-  const result: string[] = []
-
-  for (const byte of bytes) {
-    if (byte === 0xff) {
-      // End of string marker
-      break
-    }
+export interface PartyChangeEvent {
+  changedSlots: readonly number[]
+  party: PokemonBase[]
+}
 
-    const char = charMap[byte.toString() as keyof typeof charMap]
-    if (char) {
-      result.push(char)
-    }
+/**
+ * Opt-in per-parse instrumentation, collected only while
+ * PokemonSaveParser.setMetricsEnabled(true) is active so the disabled
+ * path stays a single static boolean check
+ */
+export interface ParseMetrics {
+  /** Wall-clock duration of the whole parse in milliseconds */
+  totalMs: number
+  /** Per-stage durations in milliseconds */
+  stages: {
+    loadInput: number
+    slotDetermination: number
+    sectorMapping: number
+    saveBlockExtraction: number
+    partyParse: number
   }
+  /** Sector footers read and checksummed (sectorInfo cache misses) */
+  sectorsScanned: number
+  /** Sector footer reads served from the sectorInfo cache */
+  sectorInfoCacheHits: number
+  /** Bytes materialized as writable copies during party parsing */
+  bytesCopied: number
+}
 
-  return result.join('').trim()
+function createEmptyMetrics(): ParseMetrics {
+  return {
+    totalMs: 0,
+    stages: {
+      loadInput: 0,
+      slotDetermination: 0,
+      sectorMapping: 0,
+      saveBlockExtraction: 0,
+      partyParse: 0,
+    },
+    sectorsScanned: 0,
+    sectorInfoCacheHits: 0,
+    bytesCopied: 0,
+  }
 }
 
 /**
@@ -45,21 +78,68 @@ function decodePokemonText(bytes: Uint8Array): string {
  * Now supports both file-based and memory-based parsing via WebSocket
  */
 export class PokemonSaveParser {
+  // Static so the disabled check costs one property read, not an option
+  // object per call; flipped globally via setMetricsEnabled
+  private static metricsEnabled = false
+
+  /**
+   * Enable or disable parse-stage instrumentation for all parser instances
+   */
+  static setMetricsEnabled(enabled: boolean): void {
+    PokemonSaveParser.metricsEnabled = enabled
+  }
+
+  static get isMetricsEnabled(): boolean {
+    return PokemonSaveParser.metricsEnabled
+  }
+
   private saveData: Uint8Array | null = null
   private activeSlotStart = 0
   private readonly sectorMap = new Map<number, number>()
+  // Cached per-sector footer info (keyed by physical sector index) so reparse()
+  // can skip re-checksumming sectors that are known to be unchanged
+  private readonly sectorInfoCache = new Map<number, SectorInfo>()
   private readonly forcedSlot: 1 | 2 | undefined
   private config: GameConfig | null = null
   public saveFileName: string | null = null
   public fileHandle: FileSystemFileHandle | null = null
 
+  // Reusable output buffer for reconstructSaveFile, seeded from the loaded
+  // save and patched in place so unchanged sectors are never copied again
+  private reconstructedSave: Uint8Array | null = null
+
+  // Lazily-built PC box storage; party-only parses never pay for it
+  private boxStorage: BoxStorage | null = null
+
+  // Metrics for the parse in progress (null whenever collection is disabled)
+  private currentMetrics: ParseMetrics | null = null
+  private lastParseMetrics: ParseMetrics | null = null
+
+  // What we believe the backing file currently contains on disk, so patched
+  // writes can skip sectors that are already up to date. Seeded when loading
+  // from a File/handle and kept across transient ArrayBuffer reloads
+  // (undo/redo), whose buffers do not reflect the file's contents.
+  private diskShadow: Uint8Array | null = null
+
   // Memory mode properties
   private webSocketClient: MgbaWebSocketClient | null = null
   private isMemoryMode = false
 
   // Watching properties
   private watchingChanges = false
-  private readonly watchListeners: ((partyPokemon: PokemonBase[]) => void)[] = []
+  private readonly watchListeners: ((event: PartyChangeEvent) => void)[] = []
+
+  // Delta tracking for watch mode: shadow copy of the party region plus the
+  // slots that changed since the last (coalesced) listener notification
+  private partyShadow: Uint8Array | null = null
+  private partyCountShadow: number | null = null
+  private readonly pendingChangedSlots = new Set<number>()
+  private watchFlushTimer: ReturnType<typeof setTimeout> | null = null
+  private coalesceWindowMs = 50
+
+  // Optional shared-memory party mirror, republished on every watch flush so
+  // other threads can read the party without postMessage copies
+  private partyMirror: PartyMirror | null = null
 
   constructor(forcedSlot?: 1 | 2, gameConfig?: GameConfig) {
     this.forcedSlot = forcedSlot
@@ -82,8 +162,12 @@ export class PokemonSaveParser {
     input: File | ArrayBuffer | FileSystemFileHandle | MgbaWebSocketClient
   ): Promise<void> {
     try {
-      // Always clear sectorMap before loading new data to avoid stale state
+      // Always clear sectorMap, sector cache and the reconstruction buffer
+      // before loading new data to avoid stale state
       this.sectorMap.clear()
+      this.sectorInfoCache.clear()
+      this.reconstructedSave = null
+      this.boxStorage = null
 
       // Check if input is a WebSocket client for memory mode using proper instanceof check
       if (input instanceof MgbaWebSocketClient) {
@@ -103,7 +187,9 @@ export class PokemonSaveParser {
         input = await input.getFile()
       }
 
+      let loadedFromFile = false
       if (input instanceof File) {
+        loadedFromFile = true
         // save the original file name for later use
         this.saveFileName = input.name
 
@@ -128,10 +214,14 @@ export class PokemonSaveParser {
       }
 
       this.saveData = new Uint8Array(buffer)
+      if (loadedFromFile) {
+        this.diskShadow = this.saveData.slice()
+      }
 
-      // Auto-detect config if not provided
+      // Auto-detect config if not provided; the winner's module (and its
+      // mapping data) is dynamically imported here on first use
       if (!this.config) {
-        this.config = GameConfigRegistry.detectGameConfig(this.saveData)
+        this.config = await GameConfigRegistry.resolveConfig(this.saveData)
         if (!this.config) {
           throw new Error('Unable to detect game type from save file')
         }
@@ -159,9 +249,9 @@ export class PokemonSaveParser {
     const gameTitle = await client.getGameTitle()
     console.log(`Memory mode: Connected to game "${gameTitle}"`)
 
-    // Auto-detect config based on game title using overloaded detectGameConfig method
+    // Auto-detect config based on game title, importing the winner on demand
     if (!this.config) {
-      this.config = GameConfigRegistry.detectGameConfig(gameTitle)
+      this.config = await GameConfigRegistry.resolveConfig(gameTitle)
 
       if (!this.config) {
         throw new Error(
@@ -181,9 +271,25 @@ export class PokemonSaveParser {
   }
 
   /**
-   * Get information about a specific sector
+   * Get information about a specific sector, using the cache when available
    */
   private getSectorInfo(sectorIndex: number): SectorInfo {
+    const cached = this.sectorInfoCache.get(sectorIndex)
+    if (cached) {
+      if (this.currentMetrics) this.currentMetrics.sectorInfoCacheHits++
+      return cached
+    }
+
+    if (this.currentMetrics) this.currentMetrics.sectorsScanned++
+    const info = this.computeSectorInfo(sectorIndex)
+    this.sectorInfoCache.set(sectorIndex, info)
+    return info
+  }
+
+  /**
+   * Read and validate a sector's footer directly from the save data
+   */
+  private computeSectorInfo(sectorIndex: number): SectorInfo {
     if (!this.saveData || !this.config) {
       throw new Error('Save data and config not loaded')
     }
@@ -207,8 +313,9 @@ export class PokemonSaveParser {
         return { id: sectorId, checksum, counter, valid: false }
       }
 
+      // Zero-copy view: checksum only reads, so no slice copy is needed
       const sectorStart = sectorIndex * this.config.saveLayout.sectorSize
-      const sectorData = this.saveData.slice(
+      const sectorData = this.saveData.subarray(
         sectorStart,
         sectorStart + this.config.saveLayout.sectorDataSize
       )
@@ -290,37 +397,80 @@ export class PokemonSaveParser {
   }
 
   /**
-   * Extract SaveBlock1 data from sectors 1-4
+   * Extract SaveBlock1 as a logically-contiguous zero-copy view over sectors 1-4.
+   * Missing sectors are backed by zero-filled chunks so parsing can continue gracefully.
    */
-  private extractSaveblock1(): Uint8Array {
+  private extractSaveblock1(): SectorView {
     if (!this.saveData || !this.config) {
       throw new Error('Save data and config not loaded')
     }
-    const saveblock1Sectors = [1, 2, 3, 4].filter(id => this.sectorMap.has(id))
-    if (saveblock1Sectors.length === 0) {
-      // Instead of throwing, return a zero-filled buffer to allow parsing to continue gracefully
-      return new Uint8Array(this.config.saveLayout.saveBlockSize)
+
+    const { sectorSize, sectorDataSize, saveBlockSize } = this.config.saveLayout
+    const chunks = [1, 2, 3, 4].map(sectorId => {
+      const logicalOffset = (sectorId - 1) * sectorDataSize
+      const sectorIdx = this.sectorMap.get(sectorId)
+      if (sectorIdx === undefined) {
+        return { bytes: new Uint8Array(sectorDataSize), logicalOffset }
+      }
+      const startOffset = sectorIdx * sectorSize
+      return {
+        bytes: this.saveData!.subarray(startOffset, startOffset + sectorDataSize),
+        logicalOffset,
+      }
+    })
+
+    return new SectorView(chunks, saveBlockSize)
+  }
+
+  /**
+   * Extract the PC storage sectors (5-13) as a logically-contiguous zero-copy
+   * view, mirroring extractSaveblock1's handling of missing sectors
+   */
+  private extractBoxSectors(): SectorView {
+    if (!this.saveData || !this.config) {
+      throw new Error('Save data and config not loaded')
     }
 
-    const saveblock1Data = new Uint8Array(this.config.saveLayout.saveBlockSize)
+    const { sectorSize, sectorDataSize } = this.config.saveLayout
+    const boxSectorIds = Array.from({ length: 9 }, (_, i) => i + 5)
+    const chunks = boxSectorIds.map(sectorId => {
+      const logicalOffset = (sectorId - 5) * sectorDataSize
+      const sectorIdx = this.sectorMap.get(sectorId)
+      if (sectorIdx === undefined) {
+        return { bytes: new Uint8Array(sectorDataSize), logicalOffset }
+      }
+      const startOffset = sectorIdx * sectorSize
+      return {
+        bytes: this.saveData!.subarray(startOffset, startOffset + sectorDataSize),
+        logicalOffset,
+      }
+    })
 
-    for (const sectorId of saveblock1Sectors) {
-      const sectorIdx = this.sectorMap.get(sectorId)!
-      const startOffset = sectorIdx * this.config.saveLayout.sectorSize
-      const sectorData = this.saveData.slice(
-        startOffset,
-        startOffset + this.config.saveLayout.sectorDataSize
-      )
-      const chunkOffset = (sectorId - 1) * this.config.saveLayout.sectorDataSize
+    return new SectorView(chunks, sectorDataSize * boxSectorIds.length)
+  }
 
-      saveblock1Data.set(sectorData.slice(0, this.config.saveLayout.sectorDataSize), chunkOffset)
+  /**
+   * Access PC box storage for the loaded save. Built lazily on first call so
+   * party-only parsing never touches the box sectors; boxes themselves decode
+   * on demand inside BoxStorage.
+   */
+  getBoxStorage(): BoxStorage {
+    if (this.isMemoryMode) {
+      throw new Error('Box storage is only available in file mode')
+    }
+    if (!this.saveData || !this.config) {
+      throw new Error('Save data and config not loaded')
+    }
+    if (this.sectorMap.size === 0) {
+      throw new Error('No sector map available - parse a save file first')
     }
 
-    return saveblock1Data
+    this.boxStorage ??= new BoxStorage(this.extractBoxSectors(), this.config)
+    return this.boxStorage
   }
 
   /**
-   * Extract SaveBlock2 data from sector 0
+   * Extract SaveBlock2 data from sector 0 (zero-copy view, read-only)
    */
   private extractSaveblock2(): Uint8Array {
     if (!this.saveData || !this.config) {
@@ -333,13 +483,13 @@ export class PokemonSaveParser {
 
     const sectorIdx = this.sectorMap.get(0)!
     const startOffset = sectorIdx * this.config.saveLayout.sectorSize
-    return this.saveData.slice(startOffset, startOffset + this.config.saveLayout.sectorDataSize)
+    return this.saveData.subarray(startOffset, startOffset + this.config.saveLayout.sectorDataSize)
   }
 
   /**
    * Parse party Pokemon from SaveBlock1 data or memory
    */
-  private async parsePartyPokemon(saveblock1Data?: Uint8Array): Promise<PokemonBase[]> {
+  private async parsePartyPokemon(saveblock1Data?: SectorView): Promise<PokemonBase[]> {
     if (!this.config) {
       throw new Error('Config not loaded')
     }
@@ -353,20 +503,22 @@ export class PokemonSaveParser {
         )
       }
 
-      // Get party count from WebSocket cache
-      const partyCountBuffer = await this.webSocketClient.readBytes(memoryAddresses.partyCount, 1)
-      const partyCountValue = partyCountBuffer[0] ?? 0
-
       const { maxPartySize } = this.config
+
+      // One round trip for count and data together; cached regions are
+      // served locally either way
+      const [partyCountBuffer, partyDataBuffer] = await this.webSocketClient.readBatch([
+        { address: memoryAddresses.partyCount, size: 1 },
+        { address: memoryAddresses.partyData, size: maxPartySize * this.config.pokemonSize },
+      ])
+      const partyCountValue = partyCountBuffer?.[0] ?? 0
+
       if (partyCountValue < 0 || partyCountValue > maxPartySize) {
         throw new Error(`Invalid party count: ${partyCountValue}. Expected 0-${maxPartySize}.`)
       }
-
-      // Get party data from WebSocket cache (read all at once for efficiency)
-      const partyDataBuffer = await this.webSocketClient.readBytes(
-        memoryAddresses.partyData,
-        maxPartySize * this.config.pokemonSize
-      )
+      if (!partyDataBuffer) {
+        throw new Error('Failed to read party data from memory')
+      }
 
       const pokemon: PokemonBase[] = []
 
@@ -376,7 +528,7 @@ export class PokemonSaveParser {
           pokemonOffset,
           pokemonOffset + this.config.pokemonSize
         ) as Uint8Array
-        const pokemonInstance = new PokemonBase(pokemonBytes, this.config)
+        const pokemonInstance = createPokemon(pokemonBytes, this.config)
 
         // Stop at empty slots (species ID = 0)
         if (pokemonInstance.speciesId === 0) {
@@ -397,14 +549,16 @@ export class PokemonSaveParser {
 
     for (let slot = 0; slot < this.config.maxPartySize; slot++) {
       const offset = this.config.saveLayout.partyOffset + slot * this.config.pokemonSize
-      const data = saveblock1Data.slice(offset, offset + this.config.pokemonSize)
-
-      if (data.length < this.config.pokemonSize) {
+      if (offset + this.config.pokemonSize > saveblock1Data.byteLength) {
         break
       }
 
+      // Materialize a writable copy: PokemonBase setters mutate their buffer
+      const data = saveblock1Data.slice(offset, this.config.pokemonSize)
+      if (this.currentMetrics) this.currentMetrics.bytesCopied += data.length
+
       try {
-        const pokemon = new PokemonBase(data, this.config)
+        const pokemon = createPokemon(data, this.config)
         // Check if Pokemon slot is empty (species ID = 0)
         if (pokemon.speciesId === 0) {
           break
@@ -424,7 +578,7 @@ export class PokemonSaveParser {
    */
   private parsePlayerName(saveblock2Data: Uint8Array): string {
     const playerNameBytes = saveblock2Data.slice(0, 8)
-    return decodePokemonText(playerNameBytes)
+    return decodeGbaText(playerNameBytes)
   }
 
   /**
@@ -452,21 +606,26 @@ export class PokemonSaveParser {
       throw new Error('Config not loaded')
     }
 
-    if (sectorData.length < this.config.saveLayout.sectorDataSize) {
+    const { sectorDataSize } = this.config.saveLayout
+    if (sectorData.length < sectorDataSize) {
       return 0
     }
 
     let checksum = 0
-    const view = new DataView(sectorData.buffer, sectorData.byteOffset)
-
-    for (let i = 0; i < this.config.saveLayout.sectorDataSize; i += 4) {
-      if (i + 4 <= sectorData.length) {
-        try {
-          const value = view.getUint32(i, true)
-          checksum += value
-        } catch {
-          break
-        }
+    const wordCount = sectorDataSize >>> 2
+
+    if (sectorData.byteOffset % 4 === 0) {
+      // Aligned fast path: bulk word summation over a Uint32Array view.
+      // GBA save data is little-endian, matching every platform we run on.
+      const words = new Uint32Array(sectorData.buffer, sectorData.byteOffset, wordCount)
+      for (let i = 0; i < wordCount; i++) {
+        checksum += words[i]!
+      }
+    } else {
+      // Unaligned fallback: typed array views require 4-byte alignment
+      const view = new DataView(sectorData.buffer, sectorData.byteOffset)
+      for (let i = 0; i < sectorDataSize; i += 4) {
+        checksum += view.getUint32(i, true)
       }
     }
 
@@ -474,33 +633,40 @@ export class PokemonSaveParser {
   }
 
   /**
-   * Update the party Pokémon in a SaveBlock1 buffer with the given PokemonInstance array.
-   * Returns a new Uint8Array with the updated party data.
-   * @param saveblock1 The original SaveBlock1 buffer
-   * @param party Array of PokemonInstance (max length = config.layout.party.maxSize)
+   * Map a logical SaveBlock1 byte range onto the physical sectors backing it.
+   * Sectors missing from the sector map are skipped, matching the previous
+   * reconstruction behavior for incomplete saves.
    */
-  private updatePartyInSaveblock1(
-    saveblock1: Uint8Array,
-    party: readonly PokemonBase[]
-  ): Uint8Array {
+  private mapSaveblock1Range(
+    offset: number,
+    length: number
+  ): { sectorId: number; physOffset: number; sourceStart: number; length: number }[] {
     if (!this.config) {
       throw new Error('Config not loaded')
     }
 
-    if (saveblock1.length < this.config.saveLayout.saveBlockSize) {
-      throw new Error(`SaveBlock1 must be at least ${this.config.saveLayout.saveBlockSize} bytes`)
-    }
-    if (party.length > this.config.maxPartySize) {
-      throw new Error(`Party size cannot exceed ${this.config.maxPartySize}`)
-    }
-
-    const updated = new Uint8Array(saveblock1)
-    for (let i = 0; i < party.length; i++) {
-      const offset = this.config.saveLayout.partyOffset + i * this.config.pokemonSize
-      // Use the most up-to-date raw data for each Pokemon
-      updated.set(party[i]!.rawBytes, offset)
+    const { sectorSize, sectorDataSize } = this.config.saveLayout
+    const chunks: { sectorId: number; physOffset: number; sourceStart: number; length: number }[] =
+      []
+
+    let consumed = 0
+    while (consumed < length) {
+      const logicalOffset = offset + consumed
+      const sectorId = 1 + Math.floor(logicalOffset / sectorDataSize)
+      const offsetInSector = logicalOffset % sectorDataSize
+      const chunkLength = Math.min(sectorDataSize - offsetInSector, length - consumed)
+      const sectorIdx = this.sectorMap.get(sectorId)
+      if (sectorIdx !== undefined) {
+        chunks.push({
+          sectorId,
+          physOffset: sectorIdx * sectorSize + offsetInSector,
+          sourceStart: consumed,
+          length: chunkLength,
+        })
+      }
+      consumed += chunkLength
     }
-    return updated
+    return chunks
   }
 
   /**
@@ -510,31 +676,88 @@ export class PokemonSaveParser {
   async parse(
     input: File | ArrayBuffer | FileSystemFileHandle | MgbaWebSocketClient
   ): Promise<SaveData> {
-    await this.loadInputData(input)
+    const metrics = PokemonSaveParser.metricsEnabled ? createEmptyMetrics() : null
+    this.currentMetrics = metrics
+    const startTime = metrics ? performance.now() : 0
 
-    // Memory mode: read directly from emulator memory
-    if (this.isMemoryMode && this.webSocketClient) {
-      const partyPokemon = await this.parsePartyPokemon()
+    try {
+      await this.loadInputData(input)
+      if (metrics) metrics.stages.loadInput = performance.now() - startTime
+
+      // Memory mode: read directly from emulator memory
+      if (this.isMemoryMode && this.webSocketClient) {
+        const partyStart = metrics ? performance.now() : 0
+        const partyPokemon = await this.parsePartyPokemon()
+        if (metrics) metrics.stages.partyParse = performance.now() - partyStart
+
+        // TODO: Implement memory support for player name and playtime
+        // These fields should be read from memory addresses when implemented
+        return {
+          party_pokemon: partyPokemon,
+          player_name: 'MEMORY', // TODO: Read from memory if needed
+          play_time: { hours: 0, minutes: 0, seconds: 0 }, // TODO: Read from memory if needed
+          active_slot: 0, // Memory doesn't have multiple save slots
+        }
+      }
 
-      // TODO: Implement memory support for player name and playtime
-      // These fields should be read from memory addresses when implemented
-      return {
-        party_pokemon: partyPokemon,
-        player_name: 'MEMORY', // TODO: Read from memory if needed
-        play_time: { hours: 0, minutes: 0, seconds: 0 }, // TODO: Read from memory if needed
-        active_slot: 0, // Memory doesn't have multiple save slots
+      // File mode: existing logic
+      return await this.parseFileMode()
+    } finally {
+      if (metrics) {
+        metrics.totalMs = performance.now() - startTime
+        this.lastParseMetrics = metrics
       }
+      this.currentMetrics = null
     }
+  }
+
+  /**
+   * Metrics for the most recent parse(), or null when collection was disabled
+   */
+  getLastParseMetrics(): ParseMetrics | null {
+    return this.lastParseMetrics
+  }
 
-    // File mode: existing logic
+  /**
+   * Run the file-mode parsing pipeline (slot determination, sector mapping,
+   * save block extraction) against the currently loaded save data
+   */
+  private async parseFileMode(): Promise<SaveData> {
+    const metrics = this.currentMetrics
+
+    let stageStart = metrics ? performance.now() : 0
     this.determineActiveSlot()
+    if (metrics) {
+      const now = performance.now()
+      metrics.stages.slotDetermination = now - stageStart
+      stageStart = now
+    }
+
     this.buildSectorMap()
+    if (metrics) metrics.stages.sectorMapping = performance.now() - stageStart
+
+    return this.buildSaveDataResult()
+  }
+
+  /**
+   * Extract save blocks and assemble the SaveData result using the current
+   * active slot and sector map
+   */
+  private async buildSaveDataResult(): Promise<SaveData> {
+    const metrics = this.currentMetrics
 
+    let stageStart = metrics ? performance.now() : 0
     const saveblock1Data = this.extractSaveblock1()
     const saveblock2Data = this.extractSaveblock2()
+    if (metrics) {
+      const now = performance.now()
+      metrics.stages.saveBlockExtraction = now - stageStart
+      stageStart = now
+    }
 
     const playerName = this.parsePlayerName(saveblock2Data)
     const partyPokemon = await this.parsePartyPokemon(saveblock1Data)
+    if (metrics) metrics.stages.partyParse = performance.now() - stageStart
     const playTime = this.parsePlayTime(saveblock2Data)
 
     return {
@@ -547,6 +770,105 @@ export class PokemonSaveParser {
     }
   }
 
+  /**
+   * Re-parse the currently loaded save data, reusing cached sector checksums
+   * and the sector map from the previous parse. When dirty byte ranges are
+   * provided, only sectors overlapping those ranges are re-validated; an empty
+   * set of dirty sectors skips sector scanning entirely. Call parse() instead
+   * when loading a different file.
+   *
+   * @param dirtyRanges Byte ranges of the save buffer that may have changed
+   */
+  async reparse(dirtyRanges?: { offset: number; length: number }[]): Promise<SaveData> {
+    if (this.isMemoryMode) {
+      throw new Error('reparse() is only available in file mode')
+    }
+    if (!this.saveData || !this.config) {
+      throw new Error('Save data and config not loaded')
+    }
+
+    // Without a previous parse (or known dirty ranges) fall back to a full re-scan
+    if (this.sectorMap.size === 0 || dirtyRanges === undefined) {
+      this.sectorInfoCache.clear()
+      return this.parseFileMode()
+    }
+
+    const dirtySectors = this.getDirtySectors(dirtyRanges)
+    if (dirtySectors.size === 0) {
+      // Buffer unchanged: reuse slot, sector map, and cached checksums as-is
+      return this.buildSaveDataResult()
+    }
+
+    for (const sectorIndex of dirtySectors) {
+      this.sectorInfoCache.delete(sectorIndex)
+    }
+    return this.parseFileMode()
+  }
+
+  /**
+   * Map dirty byte ranges to the physical sector indices they overlap
+   */
+  private getDirtySectors(dirtyRanges: { offset: number; length: number }[]): Set<number> {
+    const { sectorSize, sectorCount } = this.config!.saveLayout
+    const dirtySectors = new Set<number>()
+
+    for (const range of dirtyRanges) {
+      if (range.length <= 0) continue
+      const firstSector = Math.max(0, Math.floor(range.offset / sectorSize))
+      const lastSector = Math.min(
+        sectorCount - 1,
+        Math.floor((range.offset + range.length - 1) / sectorSize)
+      )
+      for (let i = firstSector; i <= lastSector; i++) {
+        dirtySectors.add(i)
+      }
+    }
+
+    return dirtySectors
+  }
+
+  /**
+   * Restore parser state from a snapshot produced by a worker-thread parse.
+   * Rebuilds PokemonBase instances and internal sector state on the main
+   * thread without re-running the sector scanning and checksum work.
+   */
+  hydrateFromSnapshot(snapshot: WorkerParseSnapshot): SaveData {
+    this.isMemoryMode = false
+    this.webSocketClient = null
+    this.saveData = snapshot.rawSaveData
+    this.boxStorage = null
+
+    // Reuse the existing config when it matches; otherwise look the worker's
+    // winner up by name (the caller is expected to have loaded it, e.g. via
+    // GameConfigRegistry.loadByName) before falling back to sync re-detection
+    if (!this.config || this.config.name !== snapshot.configName) {
+      this.config =
+        GameConfigRegistry.findLoadedByName(snapshot.configName) ??
+        GameConfigRegistry.detectGameConfig(snapshot.rawSaveData)
+    }
+    if (!this.config) {
+      throw new Error('Unable to detect game type from save file')
+    }
+
+    this.activeSlotStart = snapshot.activeSlot
+    this.sectorMap.clear()
+    this.sectorInfoCache.clear()
+    for (const [sectorId, sectorIdx] of snapshot.sectorMap) {
+      this.sectorMap.set(sectorId, sectorIdx)
+    }
+
+    const partyPokemon = snapshot.partyRaw.map(bytes => createPokemon(bytes, this.config!))
+
+    return {
+      party_pokemon: partyPokemon,
+      player_name: snapshot.playerName,
+      play_time: snapshot.playTime,
+      active_slot: this.activeSlotStart,
+      sector_map: this.sectorMap,
+      rawSaveData: this.saveData,
+    }
+  }
+
   /**
    * Get the current game configuration
    */
@@ -570,43 +892,163 @@ export class PokemonSaveParser {
 
   /**
    * Reconstruct the full save file from a new party (PokemonInstance[]).
-   * Updates SaveBlock1 with the given party and returns a new Uint8Array representing the reconstructed save file.
+   * Updates SaveBlock1 with the given party and returns the reconstructed save file.
+   *
+   * Only sectors whose party bytes actually changed are rewritten and
+   * re-checksummed: setter dirty flags select mutated slots cheaply, and a
+   * byte comparison catches reordered or externally constructed Pokemon that
+   * were never flagged. The save is assembled in a reusable internal buffer;
+   * pass `reuseBuffer` to receive that buffer directly (valid until the next
+   * call, e.g. for immediate writes to a `FileSystemWritableFileStream`)
+   * instead of an independent copy.
    *
    * @param partyPokemon Array of PokemonInstance to update party in SaveBlock1
+   * @param options.reuseBuffer Return the internal buffer without copying
    */
-  reconstructSaveFile(partyPokemon: readonly PokemonBase[]): Uint8Array {
+  reconstructSaveFile(
+    partyPokemon: readonly PokemonBase[],
+    options: { reuseBuffer?: boolean } = {}
+  ): Uint8Array {
     if (!this.saveData || !this.config) throw new Error('Save data and config not loaded')
+    if (partyPokemon.length > this.config.maxPartySize) {
+      throw new Error(`Party size cannot exceed ${this.config.maxPartySize}`)
+    }
+
+    const { sectorSize, sectorDataSize, partyOffset } = this.config.saveLayout
+    const { pokemonSize } = this.config
+
+    // Seed the reusable output buffer from the loaded save on first use
+    if (!this.reconstructedSave || this.reconstructedSave.length !== this.saveData.length) {
+      this.reconstructedSave = new Uint8Array(this.saveData)
+    }
+    const newSave = this.reconstructedSave
+
+    // Patch changed party slots into their owning sectors and note which
+    // sectors were touched (a slot's bytes may straddle a sector boundary)
+    const dirtySectors = new Set<number>()
+    for (let slot = 0; slot < partyPokemon.length; slot++) {
+      const pokemon = partyPokemon[slot]!
+      const bytes = pokemon.rawBytes
+      const chunks = this.mapSaveblock1Range(partyOffset + slot * pokemonSize, bytes.length)
+
+      const changed =
+        pokemon.isDirty ||
+        chunks.some(chunk => {
+          for (let i = 0; i < chunk.length; i++) {
+            if (newSave[chunk.physOffset + i] !== bytes[chunk.sourceStart + i]) return true
+          }
+          return false
+        })
+      if (!changed) continue
+
+      for (const chunk of chunks) {
+        newSave.set(
+          bytes.subarray(chunk.sourceStart, chunk.sourceStart + chunk.length),
+          chunk.physOffset
+        )
+        dirtySectors.add(chunk.sectorId)
+      }
+      pokemon.clearDirty()
+    }
 
-    const baseSaveblock1 = this.extractSaveblock1()
-    const updatedSaveblock1 = this.updatePartyInSaveblock1(baseSaveblock1, partyPokemon)
-    const newSave = new Uint8Array(this.saveData)
-
-    // Helper to write a sector and update its checksum
-    const writeSector = (sectorId: number, data: Uint8Array) => {
-      if (!this.config)
-        throw new Error('Game configuration not loaded during sector reconstruction')
-
-      if (!this.sectorMap.has(sectorId)) return
-      const sectorIdx = this.sectorMap.get(sectorId)!
-      const startOffset = sectorIdx * this.config.saveLayout.sectorSize
-      newSave.set(data, startOffset)
-      // Recalculate checksum for this sector
-      const checksum = this.calculateSectorChecksum(data)
-      const footerOffset = startOffset + this.config.saveLayout.sectorSize - 12
+    // Recalculate checksums only for sectors that were actually rewritten
+    for (const sectorId of dirtySectors) {
+      const sectorIdx = this.sectorMap.get(sectorId)
+      if (sectorIdx === undefined) continue
+      const startOffset = sectorIdx * sectorSize
+      const checksum = this.calculateSectorChecksum(
+        newSave.subarray(startOffset, startOffset + sectorDataSize)
+      )
+      const footerOffset = startOffset + sectorSize - 12
       const view = new DataView(newSave.buffer, newSave.byteOffset + footerOffset, 12)
       view.setUint16(2, checksum, true)
     }
 
-    // Write SaveBlock1 (sectors 1-4)
-    for (let sectorId = 1; sectorId <= 4; sectorId++) {
-      const chunkOffset = (sectorId - 1) * this.config.saveLayout.sectorDataSize
-      const chunk = updatedSaveblock1.slice(
-        chunkOffset,
-        chunkOffset + this.config.saveLayout.sectorDataSize
-      )
-      writeSector(sectorId, chunk)
+    return options.reuseBuffer ? newSave : newSave.slice()
+  }
+
+  /**
+   * Record that the backing file now contains exactly these bytes (e.g.
+   * after a full write), so later patched writes diff against the right
+   * baseline
+   */
+  markFileSynced(bytes: Uint8Array): void {
+    this.diskShadow = bytes.slice()
+  }
+
+  /**
+   * Reconstruct the save and write only the sectors that differ from what
+   * the backing file already contains, using positioned writes on a
+   * FileSystemWritableFileStream instead of rewriting all 128KB. When the
+   * on-disk contents are unknown (no shadow yet, or a size change) every
+   * sector is written. Returns the number of bytes written; 0 means the
+   * file was already up to date.
+   *
+   * @param partyPokemon Party to patch into SaveBlock1, as for reconstructSaveFile
+   * @param handle Target file handle (defaults to the handle the save was opened from)
+   */
+  async writePatched(
+    partyPokemon: readonly PokemonBase[],
+    handle?: FileSystemFileHandle
+  ): Promise<number> {
+    if (this.isMemoryMode) {
+      throw new Error('Patched writes are only available in file mode')
+    }
+    const fileHandle = handle ?? this.fileHandle
+    if (!fileHandle) {
+      throw new Error('No file handle available for patched write')
     }
-    return newSave
+    if (!this.saveData || !this.config) {
+      throw new Error('Save data and config not loaded')
+    }
+
+    const newSave = this.reconstructSaveFile(partyPokemon, { reuseBuffer: true })
+    const { sectorSize } = this.config.saveLayout
+
+    // Sector-granular diff against the disk shadow (footers included, since
+    // a sector's checksum changes together with its data)
+    const staleSectors: number[] = []
+    const shadow = this.diskShadow
+    if (shadow && shadow.length === newSave.length) {
+      for (let sectorIdx = 0; sectorIdx * sectorSize < newSave.length; sectorIdx++) {
+        const start = sectorIdx * sectorSize
+        const end = Math.min(start + sectorSize, newSave.length)
+        for (let i = start; i < end; i++) {
+          if (newSave[i] !== shadow[i]) {
+            staleSectors.push(sectorIdx)
+            break
+          }
+        }
+      }
+      if (staleSectors.length === 0) return 0
+    } else {
+      for (let sectorIdx = 0; sectorIdx * sectorSize < newSave.length; sectorIdx++) {
+        staleSectors.push(sectorIdx)
+      }
+    }
+
+    // keepExistingData is essential: without it the stream starts from an
+    // empty file and the skipped regions would be written back as zeros
+    const writable = await fileHandle.createWritable({ keepExistingData: true })
+    let bytesWritten = 0
+    try {
+      for (const sectorIdx of staleSectors) {
+        const start = sectorIdx * sectorSize
+        const data = newSave.slice(start, Math.min(start + sectorSize, newSave.length))
+        await writable.write({ type: 'write', position: start, data })
+        bytesWritten += data.length
+      }
+      await writable.close()
+    } catch (error) {
+      // Nothing was committed; discard the partial stream and keep the shadow
+      try {
+        await writable.abort()
+      } catch {}
+      throw error
+    }
+
+    this.diskShadow = newSave.slice()
+    return bytesWritten
   }
 
   /**
@@ -630,8 +1072,16 @@ export class PokemonSaveParser {
    */
   async watch(
     options: {
-      onPartyChange?: (partyPokemon: PokemonBase[]) => void
+      onPartyChange?: (event: PartyChangeEvent) => void
       onError?: (error: Error) => void
+      /** Burst coalescing window in milliseconds (default 50) */
+      coalesceWindowMs?: number
+      /**
+       * Shared-memory mirror to publish the party into on every change, so
+       * consumers on other threads follow updates via its generation counter
+       * instead of message passing
+       */
+      partyMirror?: PartyMirror
     } = {}
   ): Promise<void> {
     if (!this.isMemoryMode || !this.webSocketClient) {
@@ -656,6 +1106,9 @@ export class PokemonSaveParser {
     }
 
     try {
+      this.coalesceWindowMs = options.coalesceWindowMs ?? 50
+      this.partyMirror = options.partyMirror ?? null
+
       // Add callback to listeners if provided
       if (options.onPartyChange) {
         this.watchListeners.push(options.onPartyChange)
@@ -678,42 +1131,125 @@ export class PokemonSaveParser {
   }
 
   /**
-   * Handle memory changes from WebSocket (simplified without buffer management)
+   * Handle memory changes from WebSocket: diff against the shadow copy to find
+   * which party slots changed, then coalesce bursts into a single notification
    */
-  private async handleMemoryChange(
-    address: number,
-    _size: number,
-    _data: Uint8Array
-  ): Promise<void> {
+  private async handleMemoryChange(address: number, size: number, data: Uint8Array): Promise<void> {
     if (!this.webSocketClient || !this.config?.memoryAddresses) return
 
     try {
-      // Check if this address is relevant to our party data
       const { partyData, partyCount } = this.config.memoryAddresses
       const { pokemonSize, maxPartySize } = this.config
+      const partyBytes = maxPartySize * pokemonSize
+
+      if (address === partyCount) {
+        // A changed party count invalidates every slot (order shifts, releases)
+        const count = data[0] ?? 0
+        if (this.partyCountShadow !== count) {
+          this.partyCountShadow = count
+          for (let slot = 0; slot < maxPartySize; slot++) {
+            this.pendingChangedSlots.add(slot)
+          }
+        }
+      } else if (address < partyData + partyBytes && address + size > partyData) {
+        this.diffPartyRegion(address, size, data, partyData, pokemonSize, partyBytes)
+      } else {
+        return
+      }
 
-      const isRelevantAddress =
-        address === partyCount ||
-        (address >= partyData && address < partyData + maxPartySize * pokemonSize)
+      if (this.pendingChangedSlots.size > 0) {
+        this.scheduleWatchFlush()
+      }
+    } catch (error) {
+      console.error('Error handling party data change:', error)
+    }
+  }
 
-      if (!isRelevantAddress) {
-        return
+  /**
+   * Compare an incoming party-region update against the shadow copy and mark
+   * the slots whose bytes differ as pending
+   */
+  private diffPartyRegion(
+    address: number,
+    size: number,
+    data: Uint8Array,
+    partyData: number,
+    pokemonSize: number,
+    partyBytes: number
+  ): void {
+    const overlapStart = Math.max(address, partyData)
+    const overlapEnd = Math.min(address + size, partyData + partyBytes)
+
+    if (!this.partyShadow) {
+      // First update: everything in range counts as changed
+      this.partyShadow = new Uint8Array(partyBytes)
+      for (let offset = overlapStart; offset < overlapEnd; offset += pokemonSize) {
+        this.pendingChangedSlots.add(Math.floor((offset - partyData) / pokemonSize))
       }
+      this.partyShadow.set(
+        data.subarray(overlapStart - address, overlapEnd - address),
+        overlapStart - partyData
+      )
+      return
+    }
 
+    for (let offset = overlapStart; offset < overlapEnd; ) {
+      const slot = Math.floor((offset - partyData) / pokemonSize)
+      const slotEnd = Math.min(partyData + (slot + 1) * pokemonSize, overlapEnd)
+      for (; offset < slotEnd; offset++) {
+        if (this.partyShadow[offset - partyData] !== data[offset - address]) {
+          this.pendingChangedSlots.add(slot)
+          // Rest of this slot is dirty either way; skip straight to the next one
+          offset = slotEnd
+          break
+        }
+      }
+      offset = Math.max(offset, slotEnd)
+    }
+    this.partyShadow.set(
+      data.subarray(overlapStart - address, overlapEnd - address),
+      overlapStart - partyData
+    )
+  }
+
+  /**
+   * Schedule a coalesced flush of pending slot changes
+   */
+  private scheduleWatchFlush(): void {
+    if (this.watchFlushTimer !== null) return
+    this.watchFlushTimer = setTimeout(() => {
+      this.watchFlushTimer = null
+      void this.flushWatchNotifications()
+    }, this.coalesceWindowMs)
+  }
+
+  /**
+   * Parse the party once for all changes gathered during the coalescing window
+   * and notify listeners with the affected slots
+   */
+  private async flushWatchNotifications(): Promise<void> {
+    if (this.pendingChangedSlots.size === 0) return
+
+    try {
       // Check if we have enough data to parse party Pokemon
       const hasRequiredData = await this.hasMemoryData()
       if (!hasRequiredData) {
-        // Not enough data yet, wait for more updates
+        // Not enough data yet; keep the pending slots for the next update
         return
       }
 
+      const changedSlots = [...this.pendingChangedSlots].sort((a, b) => a - b)
+      this.pendingChangedSlots.clear()
+
       // Parse fresh Pokemon objects from WebSocket cache
-      const updatedPartyPokemon = await this.parsePartyPokemon()
+      const party = await this.parsePartyPokemon()
+
+      // Shared-memory consumers pick this up via the generation counter
+      this.partyMirror?.publish(party)
 
-      // Notify all listeners (no need for change detection as server only sends when changed)
       for (const listener of this.watchListeners) {
         try {
-          listener(updatedPartyPokemon)
+          listener({ changedSlots, party })
         } catch (error) {
           console.error('Watch listener error:', error)
         }
@@ -731,9 +1267,11 @@ export class PokemonSaveParser {
 
     const { partyData, partyCount } = this.config.memoryAddresses
     try {
-      // Try to read party count (1 byte) and party data (first pokemon) from cache
-      await this.webSocketClient.readBytes(partyCount, 1)
-      await this.webSocketClient.readBytes(partyData, this.config.pokemonSize)
+      // Probe party count (1 byte) and party data (first pokemon) in one trip
+      await this.webSocketClient.readBatch([
+        { address: partyCount, size: 1 },
+        { address: partyData, size: this.config.pokemonSize },
+      ])
       return true
     } catch {
       return false
@@ -752,6 +1290,14 @@ export class PokemonSaveParser {
       await this.webSocketClient.stopWatching()
       this.watchingChanges = false
       this.watchListeners.length = 0
+      if (this.watchFlushTimer !== null) {
+        clearTimeout(this.watchFlushTimer)
+        this.watchFlushTimer = null
+      }
+      this.pendingChangedSlots.clear()
+      this.partyShadow = null
+      this.partyCountShadow = null
+      this.partyMirror = null
     } catch (error) {
       console.error('Error stopping watch mode:', error)
     }
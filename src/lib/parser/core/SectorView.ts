@@ -0,0 +1,88 @@
+/**
+ * Zero-copy sector views for Pokemon save file parsing
+ * Exposes sector data as subarray-backed views over the original save buffer
+ * so hot paths (slot scanning, checksumming, re-parsing) avoid per-sector copies
+ */
+
+/**
+ * A chunk of a logical save block, backed by a view into the original buffer
+ */
+interface SectorChunk {
+  /** Subarray view into the original save buffer (no copy) */
+  readonly bytes: Uint8Array
+  /** Offset of this chunk within the logical block */
+  readonly logicalOffset: number
+}
+
+/**
+ * Logically-contiguous view over one or more (possibly non-adjacent) sectors.
+ * Reads are served zero-copy from the underlying save buffer whenever the
+ * requested range falls inside a single sector; a copy is only materialized
+ * when a range crosses sector boundaries or when a writable buffer is requested.
+ */
+export class SectorView {
+  private materialized: Uint8Array | null = null
+
+  constructor(
+    private readonly chunks: readonly SectorChunk[],
+    public readonly byteLength: number
+  ) {}
+
+  /**
+   * Wrap an already-contiguous buffer (e.g. a single sector) without copying
+   */
+  static fromContiguous(bytes: Uint8Array): SectorView {
+    return new SectorView([{ bytes, logicalOffset: 0 }], bytes.length)
+  }
+
+  /**
+   * Read a range of the logical block.
+   * Returns a zero-copy view into the save buffer when the range falls inside
+   * a single chunk — callers must treat the result as read-only. Ranges that
+   * span chunk boundaries are assembled into a fresh buffer.
+   */
+  getBytes(offset: number, length: number): Uint8Array {
+    for (const chunk of this.chunks) {
+      const start = offset - chunk.logicalOffset
+      if (start >= 0 && start + length <= chunk.bytes.length) {
+        return chunk.bytes.subarray(start, start + length)
+      }
+    }
+    return this.copyRange(offset, length)
+  }
+
+  /**
+   * Read a range of the logical block as an independent copy that is safe to
+   * mutate without touching the original save buffer
+   */
+  slice(offset: number, length: number): Uint8Array {
+    return this.copyRange(offset, length)
+  }
+
+  /**
+   * Materialize the full logical block as a contiguous copy (cached).
+   * Only needed when a writable, contiguous buffer is required (e.g. save
+   * reconstruction) — parsing paths should prefer getBytes.
+   */
+  toUint8Array(): Uint8Array {
+    this.materialized ??= this.copyRange(0, this.byteLength)
+    return this.materialized
+  }
+
+  private copyRange(offset: number, length: number): Uint8Array {
+    const result = new Uint8Array(length)
+    for (const chunk of this.chunks) {
+      // Intersect the requested range with this chunk and copy the overlap
+      const copyStart = Math.max(offset, chunk.logicalOffset)
+      const copyEnd = Math.min(offset + length, chunk.logicalOffset + chunk.bytes.length)
+      if (copyStart < copyEnd) {
+        const source = chunk.bytes.subarray(
+          copyStart - chunk.logicalOffset,
+          copyEnd - chunk.logicalOffset
+        )
+        result.set(source, copyStart - offset)
+      }
+    }
+    return result
+  }
+}
@@ -71,6 +71,21 @@ export interface SaveData {
   readonly __transient__?: boolean
 }
 
+/**
+ * Structured-cloneable result of a worker-thread parse.
+ * Contains everything needed to rehydrate parser state and rebuild
+ * PokemonBase instances on the main thread without re-scanning sectors.
+ */
+export interface WorkerParseSnapshot {
+  readonly configName: string
+  readonly playerName: string
+  readonly playTime: PlayTimeData
+  readonly activeSlot: number
+  readonly sectorMap: readonly (readonly [number, number])[]
+  readonly partyRaw: readonly Uint8Array[]
+  readonly rawSaveData: Uint8Array
+}
+
 // Mapping interfaces for ID translation
 interface BaseMapping {
   readonly name: string
@@ -142,6 +157,28 @@ export type SaveLayoutOverride = {
   readonly [K in keyof typeof VANILLA_SAVE_LAYOUT]?: number
 }
 
+/**
+ * Precomputed facts about a save image, built once per detection run and
+ * shared by every registered config so detection cost stays flat as more
+ * ROM-hack configs are added
+ */
+export interface DetectionContext {
+  /** Full save image under inspection */
+  readonly saveData: Uint8Array
+  /** Whether the save size is in the accepted 128KB range */
+  readonly saveSizeValid: boolean
+  /** Number of sector footers carrying the vanilla Emerald signature */
+  readonly validSignatureCount: number
+  /** True when enough signed sectors were found to trust the layout */
+  readonly hasEmeraldSignature: boolean
+  /** Active save slot offset (0 or 14) from sector counter sums */
+  readonly activeSlot: number
+  /** Sector id to physical sector index for the active slot */
+  readonly sectorMap: ReadonlyMap<number, number>
+  /** Extract SaveBlock1 for the active slot, cached across candidates */
+  getSaveBlock1(): Uint8Array | null
+}
+
 /**
  * Game configuration interface - minimal overrides only
  * Vanilla Emerald behavior is the default, games only override what's different
@@ -181,6 +218,19 @@ export interface GameConfig {
   /** Check if this config can handle the given save data */
   canHandle(saveData: Uint8Array): boolean
 
+  /**
+   * Cheap detection pre-screen using the shared precomputed facts.
+   * Should rule the config out without touching Pokemon bytes; configs that
+   * pass proceed to the trial-parse phase.
+   */
+  preScreen?(context: DetectionContext): boolean
+
+  /**
+   * Full detection using the shared precomputed facts instead of rescanning
+   * the save image. Falls back to canHandle when not implemented.
+   */
+  canHandleWithContext?(context: DetectionContext): boolean
+
   /** Check if this config can handle memory parsing for the given game title */
   canHandleMemory?(gameTitle: string): boolean
 
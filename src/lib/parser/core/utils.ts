@@ -4,13 +4,7 @@
  */
 
 import type { PokemonBase } from './PokemonBase'
-import charmapData from '../data/pokemon_charmap.json'
-
-// Convert charmap keys from strings to numbers for faster lookup
-const charmap: Record<number, string> = {}
-for (const [key, value] of Object.entries(charmapData)) {
-  charmap[parseInt(key, 10)] = value
-}
+import { decodeGbaTextLenient, encodeGbaTextInto, findGbaStringEnd } from './GbaTextCodec'
 
 /**
  * Get sprite URL for a Pokemon item
@@ -21,86 +15,45 @@ export function getItemSpriteUrl(itemIdName: string): string {
 
 /**
  * Convert byte array to string using Pokemon GBA character encoding
- * Uses the external charmap.json for accurate character conversion
+ * Routes through the shared GbaTextCodec flat tables; keeps the padding and
+ * garbage heuristics for names copied out of save data
  * See: https://bulbapedia.bulbagarden.net/wiki/Character_encoding_in_Generation_III
  */
 export function bytesToGbaString(bytes: Uint8Array): string {
-  let result = ''
-  const endIndex = findStringEnd(bytes)
-
   // Process only the actual string content (before padding/garbage)
-  for (let i = 0; i < endIndex; i++) {
-    const byte = bytes[i]!
-    const char = charmap[byte]
-
-    if (char === undefined) continue // Skip unmapped bytes
-    if (char === '\\n') result += '\n'
-    else if (char === '\\l' || char === '\\p')
-      continue // Skip control codes
-    else result += char
-  }
-
-  return result.trim()
-}
-
-/**
- * Find the actual end of a Pokemon GBA string by detecting padding patterns
- */
-function findStringEnd(bytes: Uint8Array): number {
-  // Check for trailing 0xFF padding (more than 2 suggests padding)
-  let trailingFFs = 0
-  for (let i = bytes.length - 1; i >= 0 && bytes[i] === 0xff; i--) {
-    trailingFFs++
-  }
-
-  if (trailingFFs > 2) {
-    return bytes.length - trailingFFs
-  }
-
-  // Look for garbage pattern: 0xFF followed by low values (0x01-0x0F)
-  for (let i = 0; i < bytes.length - 1; i++) {
-    if (bytes[i] === 0xff) {
-      for (let j = i + 1; j < bytes.length; j++) {
-        const nextByte = bytes[j]!
-        if (nextByte > 0 && nextByte < 0x10) return i // Found garbage
-        if (nextByte !== 0xff && nextByte !== 0) break
-      }
-    }
-  }
-
-  return bytes.length
+  return decodeGbaTextLenient(bytes, 0, findGbaStringEnd(bytes))
 }
 
 /**
  * Convert a string to a byte array using Pokemon GBA character encoding
- * Uses the external charmap.json for accurate character conversion
+ * Uses the shared GbaTextCodec reverse table for character conversion
  * Pads with 0xFF to the specified length (default 10)
  * @param str The string to encode
  * @param length The fixed length of the output array (default 10)
  * @returns Uint8Array of encoded bytes
  */
 export function gbaStringToBytes(str: string, length = 10): Uint8Array {
-  // Build a reverse charmap: char -> byte
-  const reverseCharmap: Record<string, number> = {}
-  for (const [key, value] of Object.entries(charmap)) {
-    reverseCharmap[value] = Number(key)
-  }
   const bytes = new Uint8Array(length).fill(0xff)
-  let i = 0
-  for (const char of str) {
-    if (i >= length) break
-    // Find the byte for this character
-    const byte = reverseCharmap[char]
-    if (typeof byte !== 'undefined') {
-      bytes[i++] = byte
-    } else {
-      // If not found, use 0x00 (could also skip or use a placeholder)
-      bytes[i++] = 0x00
-    }
-  }
+  encodeGbaTextInto(str, bytes, 0, length)
   return bytes
 }
 
+/**
+ * Encode multiple strings into one preallocated buffer, one fixed-length
+ * slot per string. Bulk operations (e.g. batch renames) can use the returned
+ * buffer directly instead of allocating a Uint8Array per string.
+ * @param strings The strings to encode
+ * @param length The fixed slot length per string (default 10)
+ * @returns Uint8Array of strings.length * length encoded bytes
+ */
+export function encodeGbaStrings(strings: readonly string[], length = 10): Uint8Array {
+  const buffer = new Uint8Array(strings.length * length).fill(0xff)
+  strings.forEach((str, slot) => {
+    encodeGbaTextInto(str, buffer, slot * length, length)
+  })
+  return buffer
+}
+
 /**
  * Format play time as a human-readable string
  */
@@ -232,6 +185,81 @@ export function getNatureModifier(nature: string, statIndex: number): number {
   return 1
 }
 
+// --- Memoized stat calculation ---
+
+// Single-stat results keyed by an exact packed integer: statIndex (0-5),
+// base stat (8 bits), IV (5 bits), EV (8 bits), level (7 bits) and the
+// nature effect on the stat (lower/neutral/raise) all have known small
+// ranges, so the key is collision-free. Out-of-range inputs (corrupt data)
+// are computed without caching.
+const singleStatCache = new Map<number, number>()
+
+// Full six-stat results keyed by a 32-bit FNV-1a fingerprint of all inputs.
+// The inputs are stored alongside the frozen result so a hash collision
+// falls back to recomputation instead of returning the wrong stats.
+interface TotalStatsEntry {
+  level: number
+  nature: string
+  inputs: number[]
+  stats: readonly number[]
+}
+const totalStatsCache = new Map<number, TotalStatsEntry>()
+
+const STAT_CACHE_LIMIT = 4096
+
+/**
+ * Calculate a single total stat, memoized on its packed inputs.
+ * Useful for EV/IV slider interactions where only one stat changes.
+ * @param statIndex The index of the stat (0: HP, 1: Atk, 2: Def, 3: Spe, 4: SpA, 5: SpD)
+ */
+export function calculateSingleStat(
+  statIndex: number,
+  base: number,
+  iv: number,
+  ev: number,
+  level: number,
+  nature: string
+): number {
+  const natureMod = getNatureModifier(nature, statIndex)
+
+  const packable =
+    statIndex >= 0 &&
+    statIndex < 6 &&
+    base >= 0 &&
+    base < 256 &&
+    iv >= 0 &&
+    iv < 32 &&
+    ev >= 0 &&
+    ev < 256 &&
+    level >= 0 &&
+    level < 128
+  if (packable) {
+    const natureCode = natureMod > 1 ? 2 : natureMod < 1 ? 0 : 1
+    const key = ((((statIndex * 256 + base) * 32 + iv) * 256 + ev) * 128 + level) * 3 + natureCode
+    const cached = singleStatCache.get(key)
+    if (cached !== undefined) return cached
+
+    const stat = computeStat(statIndex, base, iv, ev, level, natureMod)
+    if (singleStatCache.size >= STAT_CACHE_LIMIT) singleStatCache.clear()
+    singleStatCache.set(key, stat)
+    return stat
+  }
+
+  return computeStat(statIndex, base, iv, ev, level, natureMod)
+}
+
+function computeStat(
+  statIndex: number,
+  base: number,
+  iv: number,
+  ev: number,
+  level: number,
+  natureMod: number
+): number {
+  const core = Math.floor(((2 * base + iv + Math.floor(ev / 4)) * level) / 100)
+  return statIndex === 0 ? core + level + 10 : Math.floor((core + 5) * natureMod)
+}
+
 /**
  * Calculate total stats based on base stats, IVs, EVs, level, and nature
  * @param pokemon The Pokemon data object
@@ -242,24 +270,20 @@ export function calculateTotalStats(
   pokemon: PokemonBase,
   baseStats: readonly number[]
 ): readonly number[] {
-  // Extract properties with type guards for safety
-  const level = Number(pokemon.level)
-  const nature = String(pokemon.nature)
-
-  // Type-safe array conversion
-  const ivs: number[] = []
-  const evs: number[] = []
-
-  for (let i = 0; i < 6; i++) {
-    ivs.push(Number(pokemon.ivs[i] ?? 0))
-    evs.push(Number(pokemon.evs[i] ?? 0))
-  }
-
-  return calculateTotalStatsDirect([...baseStats], ivs, evs, level, nature)
+  return calculateTotalStatsDirect(
+    baseStats,
+    pokemon.ivs,
+    pokemon.evs,
+    Number(pokemon.level),
+    String(pokemon.nature)
+  )
 }
 
 /**
- * Calculate total stats based on base stats, IVs, EVs, level, nature (direct params version)
+ * Calculate total stats based on base stats, IVs, EVs, level, nature (direct params version).
+ * Results are memoized on a fingerprint of the inputs and returned as frozen
+ * arrays, so repeated calls with unchanged inputs are allocation-free and
+ * referentially stable for React memoization.
  * @param baseStats Array of base stats [HP, Atk, Def, Spe, SpA, SpD]
  * @param ivs Array of IVs [HP, Atk, Def, Spe, SpA, SpD]
  * @param evs Array of EVs [HP, Atk, Def, Spe, SpA, SpD]
@@ -273,27 +297,46 @@ export function calculateTotalStatsDirect(
   evs: readonly number[],
   level: number,
   nature: string
-): number[] {
-  // HP calculation
-  const hp =
-    Math.floor(((2 * baseStats[0]! + ivs[0]! + Math.floor(evs[0]! / 4)) * level) / 100) + level + 10
-
-  // Stat order: [HP, Atk, Def, Spe, SpA, SpD]
-  // Calculate non-HP stats (Atk, Def, Spe, SpA, SpD)
-  const statIndices = [1, 2, 3, 4, 5]
-  const otherStats = statIndices.map(i => {
-    const base = baseStats[i]
-    const iv = ivs[i]
-    const ev = evs[i]
-    const natureMod = getNatureModifier(nature, i)
-    const stat = Math.floor(
-      (Math.floor(((2 * base! + iv! + Math.floor(ev! / 4)) * level) / 100) + 5) * natureMod
-    )
-    return stat
-  })
+): readonly number[] {
+  // Gather inputs once; they double as the collision check for the cache
+  const inputs: number[] = []
+  for (let i = 0; i < 6; i++) {
+    inputs.push(baseStats[i] ?? 0, ivs[i] ?? 0, evs[i] ?? 0)
+  }
+
+  // 32-bit FNV-1a fingerprint over level, nature and the packed inputs
+  let hash = 0x811c9dc5
+  const mix = (value: number) => {
+    hash ^= value
+    hash = Math.imul(hash, 0x01000193)
+  }
+  mix(level)
+  mix(natures.indexOf(nature) + 1)
+  for (const value of inputs) mix(value)
+  const key = hash >>> 0
+
+  const cached = totalStatsCache.get(key)
+  if (
+    cached &&
+    cached.level === level &&
+    cached.nature === nature &&
+    cached.inputs.every((value, i) => value === inputs[i])
+  ) {
+    return cached.stats
+  }
 
-  // Return in order: HP, Atk, Def, Spe, SpA, SpD
-  return [hp, ...otherStats]
+  const stats = Object.freeze([
+    calculateSingleStat(0, inputs[0]!, inputs[1]!, inputs[2]!, level, nature),
+    calculateSingleStat(1, inputs[3]!, inputs[4]!, inputs[5]!, level, nature),
+    calculateSingleStat(2, inputs[6]!, inputs[7]!, inputs[8]!, level, nature),
+    calculateSingleStat(3, inputs[9]!, inputs[10]!, inputs[11]!, level, nature),
+    calculateSingleStat(4, inputs[12]!, inputs[13]!, inputs[14]!, level, nature),
+    calculateSingleStat(5, inputs[15]!, inputs[16]!, inputs[17]!, level, nature),
+  ]) as readonly number[]
+
+  if (totalStatsCache.size >= STAT_CACHE_LIMIT) totalStatsCache.clear()
+  totalStatsCache.set(key, { level, nature, inputs, stats })
+  return stats
 }
 
 /**
@@ -1,18 +1,19 @@
 /**
  * Game configurations index
- * Automatically registers all available game configs
+ * Registers every game lazily through its detection stub: the registry can
+ * pick a winner from signature and structural checks alone, and the winning
+ * config module (with its mapping data) is dynamically imported on demand.
+ * This file must not import the config modules statically, or their data
+ * would land back in the initial bundle.
  */
 
 import { gameConfigRegistry } from '../core/GameConfigRegistry'
-import { QuetzalConfig } from './quetzal/config'
-import { VanillaConfig } from './vanilla/config'
+import { quetzalDescriptor } from './quetzal/detect'
+import { vanillaDescriptor } from './vanilla/detect'
 
-// Register configs in priority order (most specific first)
-gameConfigRegistry.register(QuetzalConfig)
-gameConfigRegistry.register(VanillaConfig) // Vanilla last as fallback
+// Register descriptors in priority order (most specific first)
+gameConfigRegistry.registerLazy(quetzalDescriptor)
+gameConfigRegistry.registerLazy(vanillaDescriptor) // Vanilla last as fallback
 
 // Export the registry for use
 export { gameConfigRegistry as GameConfigRegistry }
-
-// Export individual configs for direct usage if needed
-export { QuetzalConfig, VanillaConfig }
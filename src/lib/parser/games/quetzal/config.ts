@@ -5,6 +5,7 @@
 
 import {
   VANILLA_SAVE_LAYOUT,
+  type DetectionContext,
   type GameConfig,
   type ItemMapping,
   type MoveMapping,
@@ -12,7 +13,8 @@ import {
   type PokemonOffsetsOverride,
   type SaveLayoutOverride,
 } from '../../core/types'
-import { createMapping, natures } from '../../core/utils'
+import { natures } from '../../core/utils'
+import { BinaryMapping } from '../../core/BinaryMapping'
 import { GameConfigBase } from '../../core/GameConfigBase'
 import itemMapData from './data/item_map.json'
 import moveMapData from './data/move_map.json'
@@ -54,11 +56,12 @@ export class QuetzalConfig extends GameConfigBase implements GameConfig {
   // Merged save layout for easy access
   readonly saveLayout = { ...VANILLA_SAVE_LAYOUT, ...this.saveLayoutOverrides }
 
-  // ID mappings for Quetzal using utility functions
+  // ID mappings for Quetzal as compact binary tables (typed-array columns,
+  // entries decoded lazily instead of one boxed object per entry up front)
   readonly mappings = {
-    pokemon: createMapping<PokemonMapping>(pokemonMapData as Record<string, unknown>),
-    items: createMapping<ItemMapping>(itemMapData as Record<string, unknown>),
-    moves: createMapping<MoveMapping>(moveMapData as Record<string, unknown>),
+    pokemon: BinaryMapping.fromJson<PokemonMapping>(pokemonMapData as Record<string, unknown>),
+    items: BinaryMapping.fromJson<ItemMapping>(itemMapData as Record<string, unknown>),
+    moves: BinaryMapping.fromJson<MoveMapping>(moveMapData as Record<string, unknown>),
   } as const
 
   // Memory addresses for Quetzal ROM hack
@@ -292,6 +295,28 @@ export class QuetzalConfig extends GameConfigBase implements GameConfig {
     }
   }
 
+  /**
+   * Pre-screen from shared detection facts: a signed image whose active
+   * slot contains SaveBlock1 sectors is worth a trial parse
+   */
+  preScreen(context: DetectionContext): boolean {
+    return context.hasEmeraldSignature && context.sectorMap.has(1)
+  }
+
+  /**
+   * Trial parse using the shared SaveBlock1 instead of re-extracting it
+   */
+  canHandleWithContext(context: DetectionContext): boolean {
+    const saveblock1Data = context.getSaveBlock1()
+    if (!saveblock1Data) return false
+    const pokemonFound = this.parsePokemonForDetection(
+      saveblock1Data,
+      this.pokemonSize,
+      (data, view) => this.getSpeciesId(data, view)
+    )
+    return pokemonFound > 0
+  }
+
   /**
    * Check if this config can handle memory parsing for the given game title
    * Currently not supported for Quetzal
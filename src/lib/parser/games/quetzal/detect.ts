@@ -0,0 +1,45 @@
+/**
+ * Lightweight detection stub for Quetzal
+ * Runs the structural trial parse (104-byte party structs, unencrypted
+ * species word) without touching the mapping tables, so the full config
+ * module and its three JSON maps are imported only for actual Quetzal saves.
+ */
+
+import { GameConfigBase } from '../../core/GameConfigBase'
+import type { DetectionContext } from '../../core/types'
+import type { LazyGameConfigDescriptor } from '../../core/GameConfigRegistry'
+
+// Structural facts; must match QuetzalConfig
+const QUETZAL_POKEMON_SIZE = 104
+const QUETZAL_SPECIES_OFFSET = 0x28
+
+/**
+ * Mapping-free structural probe reusing the shared sector helpers. The full
+ * config translates raw species ids through its mapping table before the
+ * plausibility window check, but unmapped ids fall back to the raw value
+ * there too, so probing with raw ids keeps the same acceptance behavior.
+ */
+class QuetzalProbe extends GameConfigBase {
+  detect(context: DetectionContext): boolean {
+    const saveblock1Data = context.getSaveBlock1()
+    if (!saveblock1Data) return false
+    const pokemonFound = this.parsePokemonForDetection(
+      saveblock1Data,
+      QUETZAL_POKEMON_SIZE,
+      (_data, view) => view.getUint16(QUETZAL_SPECIES_OFFSET, true)
+    )
+    return pokemonFound > 0
+  }
+}
+
+const probe = new QuetzalProbe()
+
+export const quetzalDescriptor: LazyGameConfigDescriptor = {
+  // Must match QuetzalConfig.name
+  name: 'Pokemon Quetzal',
+  // A signed image whose active slot contains SaveBlock1 sectors is worth a trial
+  preScreen: context => context.hasEmeraldSignature && context.sectorMap.has(1),
+  canHandleWithContext: context => probe.detect(context),
+  canHandleMemory: gameTitle => gameTitle.toLowerCase().includes('quetzal'),
+  load: async () => new (await import('./config')).QuetzalConfig(),
+}
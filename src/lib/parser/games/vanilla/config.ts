@@ -5,6 +5,7 @@
 
 import {
   VANILLA_SAVE_LAYOUT,
+  type DetectionContext,
   type GameConfig,
   type ItemMapping,
   type MoveMapping,
@@ -14,7 +15,7 @@ import { GameConfigBase } from '../../core/GameConfigBase'
 import itemMapData from './data/item_map.json'
 import moveMapData from './data/move_map.json'
 import pokemonMapData from './data/pokemon_map.json'
-import { createMapping } from '../../core/utils'
+import { BinaryMapping } from '../../core/BinaryMapping'
 
 /**
  * Vanilla Pokemon Emerald configuration
@@ -32,11 +33,12 @@ export class VanillaConfig extends GameConfigBase implements GameConfig {
   // Use default save layout with no overrides
   readonly saveLayout = VANILLA_SAVE_LAYOUT
 
-  // Load mapping data for translating internal IDs to external IDs using utility function
+  // Mapping data for translating internal IDs to external IDs, held as
+  // compact binary tables with lazily-decoded entries
   readonly mappings = {
-    pokemon: createMapping<PokemonMapping>(pokemonMapData as Record<string, unknown>),
-    moves: createMapping<MoveMapping>(moveMapData as Record<string, unknown>),
-    items: createMapping<ItemMapping>(itemMapData as Record<string, unknown>),
+    pokemon: BinaryMapping.fromJson<PokemonMapping>(pokemonMapData as Record<string, unknown>),
+    moves: BinaryMapping.fromJson<MoveMapping>(moveMapData as Record<string, unknown>),
+    items: BinaryMapping.fromJson<ItemMapping>(itemMapData as Record<string, unknown>),
   } as const
 
   // Memory addresses for Pokémon Emerald (USA) in mGBA (from official pokemon.lua script)
@@ -72,6 +74,21 @@ export class VanillaConfig extends GameConfigBase implements GameConfig {
     return this.hasValidEmeraldSignature(saveData)
   }
 
+  /**
+   * Pre-screen from shared detection facts: any properly signed Emerald
+   * image is a candidate for the vanilla fallback
+   */
+  preScreen(context: DetectionContext): boolean {
+    return context.hasEmeraldSignature
+  }
+
+  /**
+   * Vanilla never needs a trial parse - the signature check is the whole test
+   */
+  canHandleWithContext(context: DetectionContext): boolean {
+    return context.hasEmeraldSignature
+  }
+
   /**
    * Check if this config can handle memory parsing for the given game title
    * Supports Pokémon Emerald variants
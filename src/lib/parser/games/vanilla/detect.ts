@@ -0,0 +1,19 @@
+/**
+ * Lightweight detection stub for vanilla Emerald
+ * Only the signature facts are consulted here; the full config module (and
+ * its species/move/item mapping tables) is imported once detection picks
+ * vanilla as the winner.
+ */
+
+import type { LazyGameConfigDescriptor } from '../../core/GameConfigRegistry'
+
+export const vanillaDescriptor: LazyGameConfigDescriptor = {
+  // Must match VanillaConfig.name
+  name: 'Pokemon Emerald (Vanilla)',
+  // Any properly signed Emerald image is a candidate for the vanilla fallback
+  preScreen: context => context.hasEmeraldSignature,
+  // Vanilla never needs a trial parse - the signature check is the whole test
+  canHandleWithContext: context => context.hasEmeraldSignature,
+  canHandleMemory: gameTitle => gameTitle.toUpperCase().includes('POKEMON EMER'),
+  load: async () => new (await import('./config')).VanillaConfig(),
+}
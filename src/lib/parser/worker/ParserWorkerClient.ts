@@ -0,0 +1,122 @@
+/**
+ * Client for running PokemonSaveParser in a Web Worker
+ * Transfers the save buffer to the worker, which runs the full parse off the
+ * main thread and posts back a structured-cloneable snapshot. Callers should
+ * fall back to in-thread parsing when isSupported() returns false (CLI/Node).
+ */
+
+import type { WorkerParseSnapshot } from '../core/types'
+import type { ParseResponse } from './parser.worker'
+
+export interface WorkerParseResult {
+  snapshot: WorkerParseSnapshot
+  fileName: string | null
+  fileHandle: FileSystemFileHandle | null
+}
+
+export class ParserWorkerClient {
+  private worker: Worker | null = null
+  private nextRequestId = 1
+  private readonly pending = new Map<
+    number,
+    { resolve: (snapshot: WorkerParseSnapshot) => void; reject: (error: Error) => void }
+  >()
+
+  /**
+   * Whether worker-based parsing is available in this environment
+   */
+  static isSupported(): boolean {
+    return typeof Worker !== 'undefined'
+  }
+
+  /**
+   * Parse a save file in the worker, accepting the same file-based inputs as
+   * PokemonSaveParser.parse so callers can preserve the file handle
+   */
+  async parse(input: File | ArrayBuffer | FileSystemFileHandle): Promise<WorkerParseResult> {
+    let fileHandle: FileSystemFileHandle | null = null
+    let fileName: string | null = null
+
+    if (typeof FileSystemFileHandle !== 'undefined' && input instanceof FileSystemFileHandle) {
+      fileHandle = input
+      input = await input.getFile()
+    }
+
+    let buffer: ArrayBuffer
+    if (input instanceof File) {
+      fileName = input.name
+      buffer = await input.arrayBuffer()
+    } else {
+      // Copy caller-owned buffers: transferring would detach them
+      buffer = input.slice(0)
+    }
+
+    const snapshot = await this.parseBuffer(buffer)
+    return { snapshot, fileName, fileHandle }
+  }
+
+  /**
+   * Transfer the buffer to the worker and wait for its snapshot
+   */
+  private parseBuffer(buffer: ArrayBuffer): Promise<WorkerParseSnapshot> {
+    const worker = this.getWorker()
+    const id = this.nextRequestId++
+
+    return new Promise((resolve, reject) => {
+      this.pending.set(id, { resolve, reject })
+      worker.postMessage({ id, buffer }, [buffer])
+    })
+  }
+
+  /**
+   * Lazily create the worker (module worker so it can import the parser)
+   */
+  private getWorker(): Worker {
+    if (!this.worker) {
+      this.worker = new Worker(new URL('./parser.worker.ts', import.meta.url), { type: 'module' })
+
+      this.worker.addEventListener('message', (event: MessageEvent<ParseResponse>) => {
+        const request = this.pending.get(event.data.id)
+        if (!request) return
+        this.pending.delete(event.data.id)
+
+        if (event.data.ok && event.data.snapshot) {
+          request.resolve(event.data.snapshot)
+        } else {
+          request.reject(new Error(event.data.error ?? 'Worker parse failed'))
+        }
+      })
+
+      this.worker.addEventListener('error', event => {
+        const error = new Error(`Parser worker error: ${event.message || 'unknown'}`)
+        for (const request of this.pending.values()) {
+          request.reject(error)
+        }
+        this.pending.clear()
+      })
+    }
+    return this.worker
+  }
+
+  /**
+   * Terminate the worker and reject any in-flight requests
+   */
+  terminate(): void {
+    if (this.worker) {
+      this.worker.terminate()
+      this.worker = null
+    }
+    for (const request of this.pending.values()) {
+      request.reject(new Error('Parser worker terminated'))
+    }
+    this.pending.clear()
+  }
+}
+
+// Shared client so the app reuses a single warm worker across parses
+let sharedClient: ParserWorkerClient | null = null
+
+export function getParserWorkerClient(): ParserWorkerClient {
+  sharedClient ??= new ParserWorkerClient()
+  return sharedClient
+}
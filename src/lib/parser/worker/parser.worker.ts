@@ -0,0 +1,58 @@
+/**
+ * Web Worker entry for off-main-thread save parsing
+ * Receives a transferred ArrayBuffer, runs the full parse here (sector
+ * checksumming, substruct decryption), and posts back a structured-cloneable
+ * snapshot that the main thread can rehydrate without re-parsing
+ */
+
+import { PokemonSaveParser } from '../core/PokemonSaveParser'
+import type { WorkerParseSnapshot } from '../core/types'
+
+/** Request posted by ParserWorkerClient */
+interface ParseRequest {
+  id: number
+  buffer: ArrayBuffer
+}
+
+/** Response posted back to ParserWorkerClient */
+export interface ParseResponse {
+  id: number
+  ok: boolean
+  snapshot?: WorkerParseSnapshot
+  error?: string
+}
+
+// Typed view of the dedicated worker scope (the DOM lib types `self` as Window)
+const workerScope = self as unknown as {
+  addEventListener(type: 'message', listener: (event: MessageEvent<ParseRequest>) => void): void
+  postMessage(message: ParseResponse, options?: { transfer?: Transferable[] }): void
+}
+
+workerScope.addEventListener('message', async event => {
+  const { id, buffer } = event.data
+
+  try {
+    const parser = new PokemonSaveParser()
+    const result = await parser.parse(buffer)
+
+    const snapshot: WorkerParseSnapshot = {
+      configName: parser.gameConfig?.name ?? 'unknown',
+      playerName: result.player_name,
+      playTime: result.play_time,
+      activeSlot: result.active_slot,
+      sectorMap: [...(result.sector_map ?? [])].map(([id, idx]) => [id, idx] as const),
+      partyRaw: result.party_pokemon.map(p => p.rawBytes),
+      rawSaveData: result.rawSaveData ?? new Uint8Array(buffer),
+    }
+
+    // Transfer the save buffer and party buffers back instead of cloning them
+    const transfer = [snapshot.rawSaveData.buffer, ...snapshot.partyRaw.map(bytes => bytes.buffer)]
+    workerScope.postMessage({ id, ok: true, snapshot }, { transfer })
+  } catch (error) {
+    workerScope.postMessage({
+      id,
+      ok: false,
+      error: error instanceof Error ? error.message : 'Unknown error',
+    })
+  }
+})
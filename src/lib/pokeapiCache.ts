@@ -0,0 +1,143 @@
+/**
+ * Persistent PokeAPI response cache backed by IndexedDB.
+ *
+ * Responses are keyed by URL and served with a stale-while-revalidate policy:
+ * cache hits resolve immediately from disk, and entries past the revalidation
+ * age are refreshed in the background (rewritten only when the content hash
+ * changed). Environments without IndexedDB (Node, tests) fall through to a
+ * plain fetch.
+ */
+
+interface CachedResponse {
+  url: string
+  body: string
+  hash: number
+  storedAt: number
+}
+
+const DB_NAME = 'pokeapi-cache'
+const STORE = 'responses'
+
+// PokeAPI data is effectively immutable, so a long revalidation window is safe
+const REVALIDATE_AFTER_MS = 24 * 60 * 60 * 1000
+
+let dbPromise: Promise<IDBDatabase> | null = null
+
+function isSupported(): boolean {
+  return typeof indexedDB !== 'undefined'
+}
+
+function openDB(): Promise<IDBDatabase> {
+  dbPromise ??= new Promise((resolve, reject) => {
+    const req = indexedDB.open(DB_NAME, 1)
+    req.addEventListener('upgradeneeded', () => {
+      const db = req.result
+      if (!db.objectStoreNames.contains(STORE)) {
+        db.createObjectStore(STORE, { keyPath: 'url' })
+      }
+    })
+    req.addEventListener('success', () => resolve(req.result))
+    req.addEventListener('error', () => reject(req.error))
+  })
+  return dbPromise
+}
+
+async function readEntry(url: string): Promise<CachedResponse | undefined> {
+  const db = await openDB()
+  return new Promise((resolve, reject) => {
+    const tx = db.transaction(STORE, 'readonly')
+    const req = tx.objectStore(STORE).get(url)
+    req.addEventListener('success', () => resolve(req.result as CachedResponse | undefined))
+    req.addEventListener('error', () => reject(req.error))
+  })
+}
+
+async function writeEntry(entry: CachedResponse): Promise<void> {
+  const db = await openDB()
+  return new Promise((resolve, reject) => {
+    const tx = db.transaction(STORE, 'readwrite')
+    const req = tx.objectStore(STORE).put(entry)
+    req.addEventListener('success', () => resolve())
+    req.addEventListener('error', () => reject(req.error))
+  })
+}
+
+/**
+ * FNV-1a over the response body; cheap and good enough to detect content
+ * changes without hauling in a crypto dependency
+ */
+function hashBody(body: string): number {
+  let hash = 0x811c9dc5
+  for (let i = 0; i < body.length; i++) {
+    hash ^= body.charCodeAt(i)
+    hash = Math.imul(hash, 0x01000193)
+  }
+  return hash >>> 0
+}
+
+async function fetchBody(url: string): Promise<string> {
+  const response = await fetch(url)
+  if (!response.ok) throw new Error(`Failed to fetch from ${url}: ${response.statusText}`)
+  return response.text()
+}
+
+async function storeBody(url: string, body: string): Promise<void> {
+  try {
+    await writeEntry({ url, body, hash: hashBody(body), storedAt: Date.now() })
+  } catch (error) {
+    // Cache writes are best-effort; quota or private-mode failures are fine
+    console.warn('Failed to persist PokeAPI response:', error)
+  }
+}
+
+async function revalidate(cached: CachedResponse): Promise<void> {
+  try {
+    const body = await fetchBody(cached.url)
+    const hash = hashBody(body)
+    // Refresh the timestamp either way; rewrite the body only when it changed
+    await writeEntry(
+      hash === cached.hash
+        ? { ...cached, storedAt: Date.now() }
+        : { url: cached.url, body, hash, storedAt: Date.now() }
+    )
+  } catch {
+    // Offline or flaky network: keep serving the stale entry
+  }
+}
+
+/**
+ * Fetch a JSON document with disk-first caching.
+ * Cache hits resolve without touching the network; aged entries trigger a
+ * background revalidation so the next session sees fresh data.
+ */
+export async function fetchJsonCached<T>(url: string): Promise<T> {
+  if (!isSupported()) {
+    return JSON.parse(await fetchBody(url)) as T
+  }
+
+  const cached = await readEntry(url).catch(() => undefined)
+  if (cached) {
+    if (Date.now() - cached.storedAt > REVALIDATE_AFTER_MS) {
+      void revalidate(cached)
+    }
+    return JSON.parse(cached.body) as T
+  }
+
+  const body = await fetchBody(url)
+  void storeBody(url, body)
+  return JSON.parse(body) as T
+}
+
+/**
+ * Drop every cached PokeAPI response (exposed for debugging and tests)
+ */
+export async function clearPokeApiCache(): Promise<void> {
+  if (!isSupported()) return
+  const db = await openDB()
+  return new Promise((resolve, reject) => {
+    const tx = db.transaction(STORE, 'readwrite')
+    const req = tx.objectStore(STORE).clear()
+    req.addEventListener('success', () => resolve())
+    req.addEventListener('error', () => reject(req.error))
+  })
+}
@@ -1,8 +1,27 @@
+import type { PlayTimeData } from '@/lib/parser/core/types'
+
+/**
+ * Compact party image persisted alongside a recent file so the UI can render
+ * the party instantly on reopen, before permission is granted and the real
+ * parse completes. Raw party bytes (~100 bytes per slot) are smaller than any
+ * decoded summary and feed straight back through the normal PokemonBase path.
+ */
+export interface RecentPartySnapshot {
+  configName: string
+  playerName: string
+  playTime: PlayTimeData
+  partyRaw: Uint8Array[]
+  /** File.lastModified at the time the snapshot was taken */
+  lastModified: number
+  savedAt: number
+}
+
 export interface RecentEntry {
   id: number
   name: string
   handle: FileSystemFileHandle
   updatedAt: number
+  snapshot?: RecentPartySnapshot
 }
 
 const DB_NAME = 'pokemon-save-web'
@@ -82,7 +101,11 @@ async function deleteRecord(id: number): Promise<void> {
   })
 }
 
-export async function addRecent(handle: FileSystemFileHandle, name: string): Promise<void> {
+export async function addRecent(
+  handle: FileSystemFileHandle,
+  name: string,
+  snapshot?: RecentPartySnapshot
+): Promise<void> {
   try {
     // Normalize name
     const displayName = name || handle.name || 'Unknown file'
@@ -96,7 +119,15 @@ export async function addRecent(handle: FileSystemFileHandle, name: string): Pro
             ? await rec.handle.isSameEntry(handle)
             : undefined
         if (same === true || (rec.handle.name && rec.handle.name === handle.name)) {
-          await putRecord({ id: rec.id, name: displayName, handle, updatedAt: Date.now() })
+          await putRecord({
+            id: rec.id,
+            name: displayName,
+            handle,
+            updatedAt: Date.now(),
+            // Keep an older snapshot rather than dropping it when the caller
+            // has nothing fresh to offer
+            snapshot: snapshot ?? rec.snapshot,
+          })
           return
         }
       } catch {
@@ -105,7 +136,7 @@ export async function addRecent(handle: FileSystemFileHandle, name: string): Pro
     }
 
     // Insert new
-    await putRecord({ name: displayName, handle, updatedAt: Date.now() })
+    await putRecord({ name: displayName, handle, updatedAt: Date.now(), snapshot })
 
     // Enforce MAX_RECENTS
     const all = await listRecents()
@@ -2,8 +2,15 @@ import { QueryClient, QueryClientProvider } from '@tanstack/react-query'
 import { StrictMode } from 'react'
 import { createRoot } from 'react-dom/client'
 import { App } from './App.tsx'
+import { PokemonSaveParser } from './lib/parser/core/PokemonSaveParser'
 import './index.css'
 
+// Opt-in parse instrumentation: open the app with ?timing to collect
+// per-stage parse metrics (surfaced in the save file store and console)
+if (new URLSearchParams(window.location.search).has('timing')) {
+  PokemonSaveParser.setMetricsEnabled(true)
+}
+
 const queryClient = new QueryClient()
 
 createRoot(document.getElementById('root')!).render(
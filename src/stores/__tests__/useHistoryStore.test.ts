@@ -83,6 +83,114 @@ describe('useHistoryStore snapshots', () => {
     const { past } = useHistoryStore.getState()
     expect(past).toHaveLength(1)
     expect(past[0]?.idsBySlot).toEqual([2])
-    expect([...(past[0]?.bytes ?? [])]).toEqual([2])
+    expect(past[0]?.kind).toBe('full')
+    expect([...(past[0]?.kind === 'full' ? past[0].bytes : [])]).toEqual([2])
+  })
+})
+
+describe('useHistoryStore delta compression', () => {
+  let currentBytes: Uint8Array
+
+  const setCurrentBytes = (bytes: Uint8Array) => {
+    currentBytes = bytes
+  }
+
+  beforeEach(() => {
+    currentBytes = new Uint8Array(64)
+    useSaveFileStore.setState({
+      parser: {
+        reconstructSaveFile: () => currentBytes,
+      } as unknown as PokemonSaveParser,
+      saveData: {
+        party_pokemon: [],
+      } as never,
+      hasFile: true,
+    })
+    usePokemonStore.setState({
+      partyList: [{ id: 1 } as never],
+    })
+    useHistoryStore.setState({
+      past: [],
+      future: [],
+      initial: null,
+      isApplying: false,
+      queuedSnapshot: null,
+      queueTimer: null,
+    })
+  })
+
+  afterEach(() => {
+    useHistoryStore.setState({
+      past: [],
+      future: [],
+      initial: null,
+      isApplying: false,
+      queuedSnapshot: null,
+      queueTimer: null,
+    })
+    useSaveFileStore.setState({ parser: null, saveData: null, hasFile: false })
+    usePokemonStore.setState({ partyList: [], pendingIdsBySlot: null })
+  })
+
+  it('stores small edits as deltas sharing the keyframe buffer', () => {
+    const history = useHistoryStore.getState()
+    const base = currentBytes
+    history.snapshot()
+
+    const edited = base.slice()
+    edited[10] = 99
+    setCurrentBytes(edited)
+    history.snapshot()
+
+    const { past } = useHistoryStore.getState()
+    expect(past[0]?.kind).toBe('full')
+    expect(past[1]?.kind).toBe('delta')
+    if (past[0]?.kind === 'full' && past[1]?.kind === 'delta') {
+      expect(past[1].base).toBe(past[0].bytes)
+      expect(past[1].ranges).toHaveLength(1)
+      expect(past[1].ranges[0]?.start).toBe(10)
+      expect([...past[1].ranges[0]!.bytes]).toEqual([99])
+    }
+  })
+
+  it('inserts a fresh keyframe after the delta interval', () => {
+    const history = useHistoryStore.getState()
+    for (let i = 0; i < 9; i++) {
+      const edited = currentBytes.slice()
+      edited[i] = i + 1
+      setCurrentBytes(edited)
+      history.snapshot()
+    }
+    const kinds = useHistoryStore.getState().past.map(entry => entry.kind)
+    expect(kinds[0]).toBe('full')
+    expect(kinds.slice(1, 8)).toEqual(Array(7).fill('delta'))
+    expect(kinds[8]).toBe('full')
+  })
+
+  it('stores large rewrites as full snapshots', () => {
+    const history = useHistoryStore.getState()
+    history.snapshot()
+    setCurrentBytes(new Uint8Array(64).fill(0xff))
+    history.snapshot()
+    expect(useHistoryStore.getState().past[1]?.kind).toBe('full')
+  })
+
+  it('materializes delta entries when undoing', async () => {
+    const history = useHistoryStore.getState()
+    history.snapshot()
+
+    const edited = currentBytes.slice()
+    edited[20] = 7
+    setCurrentBytes(edited)
+    history.snapshot()
+    expect(useHistoryStore.getState().past[1]?.kind).toBe('delta')
+
+    const parseMock = vi.fn().mockResolvedValue(undefined)
+    useSaveFileStore.setState({ parse: parseMock } as never)
+    await history.undo()
+
+    expect(parseMock).toHaveBeenCalledOnce()
+    const restored = new Uint8Array(parseMock.mock.calls[0]![0] as ArrayBuffer)
+    expect([...restored]).toEqual([...edited])
   })
 })
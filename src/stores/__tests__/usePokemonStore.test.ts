@@ -1,7 +1,12 @@
 import { describe, expect, beforeEach, afterEach, it } from 'vitest'
 import type { PokemonBase } from '@/lib/parser/core/PokemonBase'
 import type { SaveData } from '@/lib/parser/core/types'
-import { buildPartyListFromSaveData, usePokemonStore } from '@/stores/usePokemonStore'
+import type { UIPokemonData } from '@/types'
+import {
+  buildPartyListFromSaveData,
+  flushPendingStatEdits,
+  usePokemonStore,
+} from '@/stores/usePokemonStore'
 
 const createPokemon = (overrides: Partial<PokemonBase> = {}): PokemonBase => {
   return {
@@ -76,3 +81,89 @@ describe('buildPartyListFromSaveData', () => {
     expect(state.nextUiId).toBe(5)
   })
 })
+
+describe('batched stat edits', () => {
+  const createEditablePokemon = (id: number): UIPokemonData => {
+    const evs = [0, 0, 0, 0, 0, 0]
+    const ivs = [31, 31, 31, 31, 31, 31]
+    const data = {
+      evs,
+      ivs,
+      level: 50,
+      nature: 'Serious',
+      setEvByIndex: (index: number, value: number) => {
+        evs[index] = value
+      },
+      setIvByIndex: (index: number, value: number) => {
+        ivs[index] = value
+      },
+      setStats: () => {},
+    } as unknown as PokemonBase
+    return {
+      id,
+      spriteUrl: '',
+      spriteAniUrl: '',
+      data,
+      details: { baseStats: [100, 100, 100, 100, 100, 100] },
+    } as unknown as UIPokemonData
+  }
+
+  beforeEach(() => {
+    flushPendingStatEdits()
+    usePokemonStore.setState({
+      activePokemonId: -1,
+      partyList: [createEditablePokemon(1), createEditablePokemon(2)],
+      megaPreview: {},
+      nextUiId: 3,
+      pendingIdsBySlot: null,
+    })
+  })
+
+  afterEach(() => {
+    flushPendingStatEdits()
+    usePokemonStore.setState({ partyList: [] })
+  })
+
+  it('coalesces rapid edits into one store update per flush', () => {
+    const { setEvIndex, partyList: before } = usePokemonStore.getState()
+    setEvIndex(1, 0, 10)
+    setEvIndex(1, 0, 20)
+    setEvIndex(1, 1, 30)
+
+    // Nothing commits until the frame flush
+    expect(usePokemonStore.getState().partyList).toBe(before)
+
+    flushPendingStatEdits()
+    const after = usePokemonStore.getState().partyList
+    expect(after).not.toBe(before)
+    // Last queued value per stat wins
+    expect(after[0]!.data.evs.slice(0, 2)).toEqual([20, 30])
+    // Untouched slots keep their identity so per-slot subscribers skip the update
+    expect(after[0]).not.toBe(before[0])
+    expect(after[1]).toBe(before[1])
+  })
+
+  it('keeps the total EV cap across queued edits', () => {
+    const { setEvIndex, getRemainingEvs } = usePokemonStore.getState()
+    setEvIndex(1, 0, 252)
+    setEvIndex(1, 1, 252)
+    setEvIndex(1, 2, 252)
+
+    // getRemainingEvs overlays the un-flushed queue
+    expect(getRemainingEvs(1)).toBe(0)
+
+    flushPendingStatEdits()
+    const pokemon = usePokemonStore.getState().partyList[0]!
+    expect(pokemon.data.evs).toEqual([252, 252, 4, 0, 0, 0])
+  })
+
+  it('flushes pending edits before a party list replacement', () => {
+    const { setIvIndex } = usePokemonStore.getState()
+    const before = usePokemonStore.getState().partyList
+    setIvIndex(2, 0, 0)
+
+    usePokemonStore.getState().setPartyList([...before])
+    // The IV edit landed on the outgoing list before the replacement
+    expect(before[1]!.data.ivs[0]).toBe(0)
+  })
+})
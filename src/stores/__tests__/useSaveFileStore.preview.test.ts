@@ -0,0 +1,96 @@
+import { readFileSync } from 'fs'
+import { dirname, resolve } from 'path'
+import { fileURLToPath } from 'url'
+import { describe, expect, beforeEach, it } from 'vitest'
+import { PokemonSaveParser } from '@/lib/parser/core/PokemonSaveParser'
+import { VanillaConfig } from '@/lib/parser/games/vanilla/config'
+import { useSaveFileStore } from '@/stores/useSaveFileStore'
+import type { RecentPartySnapshot } from '@/lib/recentFiles'
+
+// Handle ES modules in Node.js
+const __filename = fileURLToPath(import.meta.url)
+const __dirname = dirname(__filename)
+
+const loadSave = (): ArrayBuffer => {
+  const buffer = readFileSync(resolve(__dirname, '../../lib/parser/__tests__/test_data/emerald.sav'))
+  return buffer.buffer.slice(buffer.byteOffset, buffer.byteOffset + buffer.byteLength)
+}
+
+const buildSnapshot = async (): Promise<RecentPartySnapshot> => {
+  const parser = new PokemonSaveParser(undefined, new VanillaConfig())
+  const saveData = await parser.parse(loadSave())
+  return {
+    configName: new VanillaConfig().name,
+    playerName: saveData.player_name,
+    playTime: saveData.play_time,
+    partyRaw: saveData.party_pokemon.map(p => p.rawBytes),
+    lastModified: Date.now(),
+    savedAt: Date.now(),
+  }
+}
+
+describe('useSaveFileStore preview from recents snapshot', () => {
+  beforeEach(() => {
+    useSaveFileStore.setState({
+      saveData: null,
+      isLoading: false,
+      error: null,
+      hasFile: false,
+      lastParseFailed: false,
+      parser: null,
+      saveSessionId: 0,
+      lastUpdateTransient: false,
+      parseMetrics: null,
+      isPreviewData: false,
+    })
+  })
+
+  it('rebuilds the party from persisted raw bytes', async () => {
+    const snapshot = await buildSnapshot()
+    expect(snapshot.partyRaw.length).toBeGreaterThan(0)
+
+    const shown = await useSaveFileStore.getState().previewFromSnapshot(snapshot)
+    expect(shown).toBe(true)
+
+    const state = useSaveFileStore.getState()
+    expect(state.hasFile).toBe(true)
+    expect(state.isPreviewData).toBe(true)
+    expect(state.saveSessionId).toBe(1)
+    expect(state.saveData?.player_name).toBe(snapshot.playerName)
+    expect(state.saveData?.party_pokemon.length).toBe(snapshot.partyRaw.length)
+    // Previewed Pokemon decode the same stats the real parse produced
+    const reference = new PokemonSaveParser(undefined, new VanillaConfig())
+    const parsed = await reference.parse(loadSave())
+    expect(state.saveData?.party_pokemon[0]?.maxHp).toBe(parsed.party_pokemon[0]?.maxHp)
+    expect(state.saveData?.party_pokemon[0]?.nickname).toBe(parsed.party_pokemon[0]?.nickname)
+  })
+
+  it('never paints over an already loaded file', async () => {
+    const snapshot = await buildSnapshot()
+    useSaveFileStore.setState({ hasFile: true })
+
+    expect(await useSaveFileStore.getState().previewFromSnapshot(snapshot)).toBe(false)
+    expect(useSaveFileStore.getState().saveData).toBeNull()
+  })
+
+  it('skips snapshots taken with a config that is no longer registered', async () => {
+    const snapshot = { ...(await buildSnapshot()), configName: 'Removed Hack' }
+
+    expect(await useSaveFileStore.getState().previewFromSnapshot(snapshot)).toBe(false)
+    expect(useSaveFileStore.getState().hasFile).toBe(false)
+  })
+
+  it('clearPreview drops a preview but leaves real data alone', async () => {
+    const snapshot = await buildSnapshot()
+    await useSaveFileStore.getState().previewFromSnapshot(snapshot)
+
+    useSaveFileStore.getState().clearPreview()
+    expect(useSaveFileStore.getState().hasFile).toBe(false)
+    expect(useSaveFileStore.getState().isPreviewData).toBe(false)
+
+    // Simulate a completed real parse: clearPreview must not clear it
+    useSaveFileStore.setState({ hasFile: true, isPreviewData: false })
+    useSaveFileStore.getState().clearPreview()
+    expect(useSaveFileStore.getState().hasFile).toBe(true)
+  })
+})
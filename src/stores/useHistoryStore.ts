@@ -7,10 +7,33 @@ interface HistorySnapshot {
   idsBySlot: number[]
 }
 
+/** A contiguous run of bytes that differ from the shared keyframe */
+interface DeltaRange {
+  start: number
+  bytes: Uint8Array
+}
+
+/**
+ * History entries are stored either as full save images ("keyframes") or as
+ * byte-range deltas against the nearest preceding keyframe in the same stack.
+ * Unchanged bytes share the keyframe's buffer, so an editing session that
+ * only touches a few Pokemon keeps one full copy plus tiny deltas instead of
+ * a 128KB snapshot per edit.
+ */
+type StoredSnapshot =
+  | { kind: 'full'; bytes: Uint8Array; idsBySlot: number[] }
+  | { kind: 'delta'; base: Uint8Array; ranges: DeltaRange[]; idsBySlot: number[] }
+
+/** Store a full keyframe at most every N entries; the rest are deltas */
+const FULL_SNAPSHOT_INTERVAL = 8
+
+/** Changed spans closer together than this are merged into one range */
+const RANGE_MERGE_GAP = 8
+
 interface HistoryState {
-  // Snapshots of full save bytes + UI ids per party slot
-  past: HistorySnapshot[]
-  future: HistorySnapshot[]
+  // Snapshots of save bytes + UI ids per party slot, delta-compressed
+  past: StoredSnapshot[]
+  future: StoredSnapshot[]
   initial: HistorySnapshot | null
   isApplying: boolean
   queuedSnapshot: HistorySnapshot | null
@@ -34,15 +57,116 @@ interface HistoryActions {
 
 export type HistoryStore = HistoryState & HistoryActions
 
+function bytesEqual(a: Uint8Array, b: Uint8Array): boolean {
+  if (a.length !== b.length) return false
+  for (let i = 0; i < a.length; i++) {
+    if (a[i] !== b[i]) return false
+  }
+  return true
+}
+
+function idsEqual(a: number[], b: number[]): boolean {
+  if (a.length !== b.length) return false
+  for (let i = 0; i < a.length; i++) {
+    if (a[i] !== b[i]) return false
+  }
+  return true
+}
+
 function areSnapshotsEqual(a: HistorySnapshot, b: HistorySnapshot): boolean {
-  const { bytes: bytesA, idsBySlot: idsA } = a
-  const { bytes: bytesB, idsBySlot: idsB } = b
-  if (bytesA.length !== bytesB.length || idsA.length !== idsB.length) return false
-  for (let i = 0; i < bytesA.length; i++) {
-    if (bytesA[i] !== bytesB[i]) return false
+  return idsEqual(a.idsBySlot, b.idsBySlot) && bytesEqual(a.bytes, b.bytes)
+}
+
+/**
+ * Collect the byte ranges where `bytes` differs from `base`, merging spans
+ * separated by fewer than RANGE_MERGE_GAP unchanged bytes. Range contents are
+ * copied so the delta doesn't pin the snapshot's full buffer in memory.
+ */
+function diffRanges(base: Uint8Array, bytes: Uint8Array): DeltaRange[] {
+  const ranges: DeltaRange[] = []
+  let start = -1
+  let end = -1
+  for (let i = 0; i < bytes.length; i++) {
+    if (base[i] === bytes[i]) continue
+    if (start >= 0 && i - end <= RANGE_MERGE_GAP) {
+      end = i + 1
+      continue
+    }
+    if (start >= 0) {
+      ranges.push({ start, bytes: bytes.slice(start, end) })
+    }
+    start = i
+    end = i + 1
   }
-  for (let i = 0; i < idsA.length; i++) {
-    if (idsA[i] !== idsB[i]) return false
+  if (start >= 0) {
+    ranges.push({ start, bytes: bytes.slice(start, end) })
+  }
+  return ranges
+}
+
+/**
+ * Encode a snapshot for storage: delta against the stack's most recent
+ * keyframe when one is close enough, otherwise keep a full copy
+ */
+function encodeSnapshot(stack: StoredSnapshot[], snap: HistorySnapshot): StoredSnapshot {
+  let deltasSinceFull = 0
+  let keyframe: Uint8Array | null = null
+  for (let i = stack.length - 1; i >= 0; i--) {
+    const entry = stack[i]!
+    if (entry.kind === 'full') {
+      keyframe = entry.bytes
+      break
+    }
+    deltasSinceFull++
+  }
+  if (
+    !keyframe ||
+    keyframe.length !== snap.bytes.length ||
+    deltasSinceFull >= FULL_SNAPSHOT_INTERVAL - 1
+  ) {
+    return { kind: 'full', bytes: snap.bytes, idsBySlot: snap.idsBySlot }
+  }
+  const ranges = diffRanges(keyframe, snap.bytes)
+  // A delta approaching the size of the save itself defeats the purpose
+  const deltaSize = ranges.reduce((sum, range) => sum + range.bytes.length, 0)
+  if (deltaSize > snap.bytes.length / 2) {
+    return { kind: 'full', bytes: snap.bytes, idsBySlot: snap.idsBySlot }
+  }
+  return { kind: 'delta', base: keyframe, ranges, idsBySlot: snap.idsBySlot }
+}
+
+function pushSnapshot(stack: StoredSnapshot[], snap: HistorySnapshot): StoredSnapshot[] {
+  return [...stack, encodeSnapshot(stack, snap)]
+}
+
+/** Rebuild the full save bytes for a stored entry */
+function materializeSnapshot(stored: StoredSnapshot): Uint8Array {
+  if (stored.kind === 'full') return stored.bytes
+  const bytes = stored.base.slice()
+  for (const range of stored.ranges) {
+    bytes.set(range.bytes, range.start)
+  }
+  return bytes
+}
+
+/** Compare a stored entry against a raw snapshot without materializing it */
+function storedEqualsSnapshot(stored: StoredSnapshot, snap: HistorySnapshot): boolean {
+  if (!idsEqual(stored.idsBySlot, snap.idsBySlot)) return false
+  if (stored.kind === 'full') return bytesEqual(stored.bytes, snap.bytes)
+  if (stored.base.length !== snap.bytes.length) return false
+  let cursor = 0
+  for (const range of stored.ranges) {
+    // Unchanged gaps must match the shared keyframe, ranges the delta bytes
+    for (let i = cursor; i < range.start; i++) {
+      if (stored.base[i] !== snap.bytes[i]) return false
+    }
+    for (let i = 0; i < range.bytes.length; i++) {
+      if (range.bytes[i] !== snap.bytes[range.start + i]) return false
+    }
+    cursor = range.start + range.bytes.length
+  }
+  for (let i = cursor; i < snap.bytes.length; i++) {
+    if (stored.base[i] !== snap.bytes[i]) return false
   }
   return true
 }
@@ -73,8 +197,8 @@ export const useHistoryStore = create<HistoryStore>((set, get) => ({
     if (!snap) return
     const { past } = get()
     const last = past[past.length - 1]
-    if (last && areSnapshotsEqual(last, snap)) return
-    set({ past: [...past, snap], future: [] })
+    if (last && storedEqualsSnapshot(last, snap)) return
+    set({ past: pushSnapshot(past, snap), future: [] })
   },
 
   queueSnapshot: (delayMs = 350, idsBySlotOverride?: number[]) => {
@@ -93,11 +217,11 @@ export const useHistoryStore = create<HistoryStore>((set, get) => ({
       }
       set(current => {
         const last = current.past[current.past.length - 1]
-        if (last && areSnapshotsEqual(last, pending)) {
+        if (last && storedEqualsSnapshot(last, pending)) {
           return { queuedSnapshot: null, queueTimer: null }
         }
         return {
-          past: [...current.past, pending],
+          past: pushSnapshot(current.past, pending),
           queuedSnapshot: null,
           queueTimer: null,
           future: [],
@@ -134,7 +258,7 @@ export const useHistoryStore = create<HistoryStore>((set, get) => ({
     if (stateBefore.queuedSnapshot) {
       if (stateBefore.queueTimer) clearTimeout(stateBefore.queueTimer)
       set({
-        past: [...stateBefore.past, stateBefore.queuedSnapshot],
+        past: pushSnapshot(stateBefore.past, stateBefore.queuedSnapshot),
         queuedSnapshot: null,
         queueTimer: null,
       })
@@ -147,16 +271,17 @@ export const useHistoryStore = create<HistoryStore>((set, get) => ({
     set({ isApplying: true })
     try {
       // Move current to future, pop previous from past, then parse previous
-      set(state => ({ future: [...state.future, current], past: state.past.slice(0, -1) }))
+      set(state => ({ future: pushSnapshot(state.future, current), past: state.past.slice(0, -1) }))
       const { parse } = useSaveFileStore.getState()
       // Provide UI ids for slot mapping during rebuild
       try {
         usePokemonStore.getState().setPendingIdsBySlot(previous.idsBySlot)
       } catch {}
+      const previousBytes = materializeSnapshot(previous)
       await parse(
-        previous.bytes.buffer.slice(
-          previous.bytes.byteOffset,
-          previous.bytes.byteOffset + previous.bytes.byteLength
+        previousBytes.buffer.slice(
+          previousBytes.byteOffset,
+          previousBytes.byteOffset + previousBytes.byteLength
         ),
         { transient: true }
       )
@@ -172,7 +297,7 @@ export const useHistoryStore = create<HistoryStore>((set, get) => ({
     if (stateBefore.queuedSnapshot) {
       if (stateBefore.queueTimer) clearTimeout(stateBefore.queueTimer)
       set({
-        past: [...stateBefore.past, stateBefore.queuedSnapshot],
+        past: pushSnapshot(stateBefore.past, stateBefore.queuedSnapshot),
         queuedSnapshot: null,
         queueTimer: null,
       })
@@ -185,16 +310,14 @@ export const useHistoryStore = create<HistoryStore>((set, get) => ({
     set({ isApplying: true })
     try {
       // Move current to past, pop next from future, then parse next
-      set(state => ({ past: [...state.past, current], future: state.future.slice(0, -1) }))
+      set(state => ({ past: pushSnapshot(state.past, current), future: state.future.slice(0, -1) }))
       const { parse } = useSaveFileStore.getState()
       try {
         usePokemonStore.getState().setPendingIdsBySlot(next.idsBySlot)
       } catch {}
+      const nextBytes = materializeSnapshot(next)
       await parse(
-        next.bytes.buffer.slice(
-          next.bytes.byteOffset,
-          next.bytes.byteOffset + next.bytes.byteLength
-        ),
+        nextBytes.buffer.slice(nextBytes.byteOffset, nextBytes.byteOffset + nextBytes.byteLength),
         { transient: true }
       )
     } finally {
@@ -209,7 +332,7 @@ export const useHistoryStore = create<HistoryStore>((set, get) => ({
     if (stateBefore.queuedSnapshot) {
       if (stateBefore.queueTimer) clearTimeout(stateBefore.queueTimer)
       set({
-        past: [...stateBefore.past, stateBefore.queuedSnapshot],
+        past: pushSnapshot(stateBefore.past, stateBefore.queuedSnapshot),
         queuedSnapshot: null,
         queueTimer: null,
       })
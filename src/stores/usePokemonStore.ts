@@ -1,4 +1,6 @@
 import { create } from 'zustand'
+import { subscribeWithSelector } from 'zustand/middleware'
+import { useShallow } from 'zustand/react/shallow'
 import type { PokemonBase } from '@/lib/parser/core/PokemonBase'
 import type { SaveData } from '@/lib/parser/core/types'
 import { calculateTotalStats, natures } from '@/lib/parser/core/utils'
@@ -10,6 +12,102 @@ import { useSaveFileStore } from './useSaveFileStore'
 const MAX_EV_PER_STAT = 252
 const MAX_TOTAL_EVS = 508
 
+// Rapid successive stat edits (EV/IV slider drags) are coalesced here and
+// committed as one store update per animation frame, so a drag costs one
+// re-render of the edited slot per frame instead of one per pointer event
+type StatEditKind = 'ev' | 'iv'
+interface PendingStatEdit {
+  kind: StatEditKind
+  pokemonId: number
+  statIndex: number
+  value: number
+}
+const pendingStatEdits = new Map<string, PendingStatEdit>()
+let statEditFlushScheduled = false
+
+const queueStatEdit = (edit: PendingStatEdit): void => {
+  // Later values for the same stat replace earlier ones within the frame
+  pendingStatEdits.set(`${edit.kind}:${edit.pokemonId}:${edit.statIndex}`, edit)
+  if (statEditFlushScheduled) return
+  statEditFlushScheduled = true
+  if (typeof requestAnimationFrame === 'function') {
+    requestAnimationFrame(() => flushPendingStatEdits())
+  } else {
+    // Node/test environments without a frame clock flush on the microtask
+    queueMicrotask(() => flushPendingStatEdits())
+  }
+}
+
+const applyStatEdits = (partyList: UIPokemonData[], edits: PendingStatEdit[]): UIPokemonData[] => {
+  const editsByPokemon = new Map<number, PendingStatEdit[]>()
+  for (const edit of edits) {
+    const list = editsByPokemon.get(edit.pokemonId)
+    if (list) list.push(edit)
+    else editsByPokemon.set(edit.pokemonId, [edit])
+  }
+
+  return partyList.map(p => {
+    const pokemonEdits = editsByPokemon.get(p.id)
+    if (!pokemonEdits || !p.details) return p
+
+    let changed = false
+    for (const edit of pokemonEdits) {
+      if (edit.kind === 'ev') {
+        // Validate EV constraints
+        const clampedEvValue = Math.max(0, Math.min(MAX_EV_PER_STAT, edit.value))
+
+        // Calculate current total EVs excluding the stat being changed
+        const currentEvs = p.data.evs
+        const otherEvsTotal = currentEvs.reduce(
+          (sum, ev, index) => (index === edit.statIndex ? sum : sum + ev),
+          0
+        )
+
+        // Ensure total EVs don't exceed limit
+        const maxAllowedForThisStat = Math.min(MAX_EV_PER_STAT, MAX_TOTAL_EVS - otherEvsTotal)
+        const finalEvValue = Math.min(clampedEvValue, maxAllowedForThisStat)
+
+        // Only update if the value actually changed
+        if (currentEvs[edit.statIndex] === finalEvValue) continue
+        useHistoryStore.getState().queueSnapshot()
+
+        // Directly mutate the class instance
+        p.data.setEvByIndex(edit.statIndex, finalEvValue)
+        changed = true
+      } else {
+        // Only update if the value actually changed
+        if (p.data.ivs[edit.statIndex] === edit.value) continue
+        useHistoryStore.getState().queueSnapshot()
+
+        // Directly mutate the class instance
+        p.data.setIvByIndex(edit.statIndex, edit.value)
+        changed = true
+      }
+    }
+
+    if (!changed) return p
+    p.data.setStats(calculateTotalStats(p.data, p.details.baseStats))
+    // Return a new object reference for React to detect change; untouched
+    // slots keep their identity so per-slot subscribers skip the update
+    return { ...p }
+  })
+}
+
+/**
+ * Apply any coalesced stat edits immediately. Actions that read or replace
+ * the party list call this first so they never observe a stale frame.
+ */
+export const flushPendingStatEdits = (): void => {
+  if (pendingStatEdits.size === 0) {
+    statEditFlushScheduled = false
+    return
+  }
+  const edits = [...pendingStatEdits.values()]
+  pendingStatEdits.clear()
+  statEditFlushScheduled = false
+  usePokemonStore.setState(state => ({ partyList: applyStatEdits(state.partyList, edits) }))
+}
+
 export interface PokemonState {
   activePokemonId: number
   partyList: UIPokemonData[]
@@ -39,7 +137,7 @@ export interface PokemonActions {
 
 export type PokemonStore = PokemonState & PokemonActions
 
-export const usePokemonStore = create<PokemonStore>((set, get) => ({
+export const usePokemonStore = create<PokemonStore>()(subscribeWithSelector((set, get) => ({
   // Initial state
   activePokemonId: -1,
   partyList: [],
@@ -53,60 +151,20 @@ export const usePokemonStore = create<PokemonStore>((set, get) => ({
   },
 
   setPartyList: (partyList: UIPokemonData[]) => {
+    flushPendingStatEdits()
     set({ partyList })
   },
 
   setEvIndex: (pokemonId: number, statIndex: number, evValue: number) => {
-    set(state => ({
-      partyList: state.partyList.map(p => {
-        if (p.id !== pokemonId || !p.details) return p
-
-        // Validate EV constraints
-        const clampedEvValue = Math.max(0, Math.min(MAX_EV_PER_STAT, evValue))
-
-        // Calculate current total EVs excluding the stat being changed
-        const currentEvs = p.data.evs
-        const otherEvsTotal = currentEvs.reduce(
-          (sum, ev, index) => (index === statIndex ? sum : sum + ev),
-          0
-        )
-
-        // Ensure total EVs don't exceed limit
-        const maxAllowedForThisStat = Math.min(MAX_EV_PER_STAT, MAX_TOTAL_EVS - otherEvsTotal)
-        const finalEvValue = Math.min(clampedEvValue, maxAllowedForThisStat)
-
-        // Only update if the value actually changed
-        if (currentEvs[statIndex] === finalEvValue) return p
-        useHistoryStore.getState().queueSnapshot()
-
-        // Directly mutate the class instance
-        p.data.setEvByIndex(statIndex, finalEvValue)
-        p.data.setStats(calculateTotalStats(p.data, p.details.baseStats))
-        // Return a new object reference for React to detect change
-        return { ...p }
-      }),
-    }))
+    queueStatEdit({ kind: 'ev', pokemonId, statIndex, value: evValue })
   },
 
   setIvIndex: (pokemonId: number, statIndex: number, ivValue: number) => {
-    set(state => ({
-      partyList: state.partyList.map(p => {
-        if (p.id !== pokemonId || !p.details) return p
-
-        // Only update if the value actually changed
-        if (p.data.ivs[statIndex] === ivValue) return p
-        useHistoryStore.getState().queueSnapshot()
-
-        // Directly mutate the class instance
-        p.data.setIvByIndex(statIndex, ivValue)
-        p.data.setStats(calculateTotalStats(p.data, p.details.baseStats))
-        // Return a new object reference for React to detect change
-        return { ...p }
-      }),
-    }))
+    queueStatEdit({ kind: 'iv', pokemonId, statIndex, value: ivValue })
   },
 
   setNature: (pokemonId: number, nature: string) => {
+    flushPendingStatEdits()
     set(state => ({
       partyList: state.partyList.map(p => {
         const natureValue = natures.indexOf(nature)
@@ -123,6 +181,7 @@ export const usePokemonStore = create<PokemonStore>((set, get) => ({
   },
 
   setAbilitySlot: (pokemonId: number, slot: number) => {
+    flushPendingStatEdits()
     set(state => ({
       partyList: state.partyList.map(p => {
         if (p.id !== pokemonId || !p.details) return p
@@ -136,6 +195,7 @@ export const usePokemonStore = create<PokemonStore>((set, get) => ({
   },
 
   setItemId: (pokemonId: number, itemId: number | null) => {
+    flushPendingStatEdits()
     set(state => ({
       partyList: state.partyList.map(p => {
         if (p.id !== pokemonId) return p
@@ -190,11 +250,22 @@ export const usePokemonStore = create<PokemonStore>((set, get) => ({
     const { partyList } = get()
     const pokemon = partyList.find(p => p.id === pokemonId)
     if (!pokemon) return MAX_TOTAL_EVS
-    const totalEvs = pokemon.data.evs.reduce((sum, ev) => sum + ev, 0)
+    // Overlay un-flushed EV edits read-only instead of flushing: this is
+    // called during render, where a store update is not allowed
+    const evs = [...pokemon.data.evs]
+    for (const edit of pendingStatEdits.values()) {
+      if (edit.kind !== 'ev' || edit.pokemonId !== pokemonId) continue
+      const clamped = Math.max(0, Math.min(MAX_EV_PER_STAT, edit.value))
+      const otherTotal = evs.reduce((sum, ev, i) => (i === edit.statIndex ? sum : sum + ev), 0)
+      evs[edit.statIndex] = Math.min(clamped, MAX_TOTAL_EVS - otherTotal)
+    }
+    const totalEvs = evs.reduce((sum, ev) => sum + ev, 0)
     return Math.max(0, MAX_TOTAL_EVS - totalEvs)
   },
 
   resetPokemonData: () => {
+    // Pending edits target the outgoing party; drop them instead of flushing
+    pendingStatEdits.clear()
     set({
       activePokemonId: -1,
       partyList: [],
@@ -202,6 +273,7 @@ export const usePokemonStore = create<PokemonStore>((set, get) => ({
   },
 
   clearPokemonDetails: () => {
+    flushPendingStatEdits()
     set(state => ({
       partyList: state.partyList.map(p => ({ ...p, details: undefined })),
     }))
@@ -216,6 +288,7 @@ export const usePokemonStore = create<PokemonStore>((set, get) => ({
   },
 
   commitPartyReorder: (newOrder: UIPokemonData[], previousIds?: number[]) => {
+    flushPendingStatEdits()
     set({ partyList: newOrder })
     try {
       useHistoryStore.getState().queueSnapshot(350, previousIds)
@@ -225,10 +298,26 @@ export const usePokemonStore = create<PokemonStore>((set, get) => ({
       useSaveFileStore.getState().updatePartyOrder(bases)
     } catch {}
   },
-}))
+})))
+
+/**
+ * Fine-grained party selectors. Party cards subscribe per slot so an EV
+ * slider drag only re-renders the edited card: stat edits return a new
+ * object reference for the touched slot and keep every other slot's
+ * identity, which the default `Object.is` equality turns into a skip.
+ */
+export const usePartySlotIds = (): number[] =>
+  usePokemonStore(useShallow(state => state.partyList.map(p => p.id)))
+
+export const usePartyPokemon = (id: number): UIPokemonData | undefined =>
+  usePokemonStore(state => state.partyList.find(p => p.id === id))
+
+export const useIsActivePokemon = (id: number): boolean =>
+  usePokemonStore(state => state.activePokemonId === id)
 
 // Helper function to build party list from save data
 export const buildPartyListFromSaveData = (saveData: SaveData): UIPokemonData[] => {
+  flushPendingStatEdits()
   const {
     partyList: prevList,
     pendingIdsBySlot: pending,
@@ -1,10 +1,13 @@
 import { saveAs } from 'file-saver'
 import { toast } from 'sonner'
 import { create } from 'zustand'
-import { addRecent } from '@/lib/recentFiles'
-import { PokemonSaveParser } from '../lib/parser/core/PokemonSaveParser'
+import { addRecent, type RecentPartySnapshot } from '@/lib/recentFiles'
+import { PokemonSaveParser, type ParseMetrics } from '../lib/parser/core/PokemonSaveParser'
+import { ParserWorkerClient, getParserWorkerClient } from '../lib/parser/worker/ParserWorkerClient'
+import { createPokemon } from '../lib/parser/core/PokemonAccessors'
+import { GameConfigRegistry } from '../lib/parser/games'
+import type { GameConfig, SaveData } from '../lib/parser/core/types'
 import type { PokemonBase } from '../lib/parser/core/PokemonBase'
-import type { SaveData } from '../lib/parser/core/types'
 import { usePokemonStore } from './usePokemonStore'
 import { useSettingsStore } from './useSettingsStore'
 
@@ -19,6 +22,12 @@ export interface SaveFileState {
   saveSessionId: number
   // True when last parse was a transient state update (e.g. undo/redo/reset)
   lastUpdateTransient: boolean
+  // Per-stage timings of the last parse; null unless metrics collection is
+  // enabled (open the app with ?timing)
+  parseMetrics: ParseMetrics | null
+  // True while saveData holds a party rebuilt from a persisted recents
+  // snapshot, before the real parse of the underlying file has finished
+  isPreviewData: boolean
 }
 
 export interface SaveFileActions {
@@ -30,6 +39,12 @@ export interface SaveFileActions {
   clearSaveFile: () => void
   reconstructAndDownload: (method?: 'download' | 'saveAs' | 'save') => Promise<void>
   updatePartyOrder: (party: PokemonBase[]) => void
+  // Render a party immediately from a persisted recents snapshot while the
+  // real parse proceeds; returns whether the preview was shown
+  previewFromSnapshot: (snapshot: RecentPartySnapshot) => Promise<boolean>
+  // Drop a lingering preview (e.g. file permission was denied); no-op once a
+  // real parse has taken over
+  clearPreview: () => void
 }
 
 export type SaveFileStore = SaveFileState & SaveFileActions
@@ -44,6 +59,8 @@ export const useSaveFileStore = create<SaveFileStore>((set, get) => ({
   parser: null,
   saveSessionId: 0,
   lastUpdateTransient: false,
+  parseMetrics: null,
+  isPreviewData: false,
 
   // Actions
   parse: async (
@@ -73,7 +90,34 @@ export const useSaveFileStore = create<SaveFileStore>((set, get) => ({
       let { parser } = get()
       if (!parser) parser = new PokemonSaveParser()
 
-      const saveData = await parser.parse(input)
+      let saveData: SaveData
+      if (ParserWorkerClient.isSupported()) {
+        try {
+          // Parse off the main thread; hydrate the parser from the snapshot so
+          // later edits and reconstruction work without re-parsing
+          const { snapshot, fileName, fileHandle } = await getParserWorkerClient().parse(input)
+          // The worker detected the game in its own module graph; make sure
+          // the same config module is loaded on this thread before hydrating
+          await GameConfigRegistry.loadByName(snapshot.configName)
+          saveData = parser.hydrateFromSnapshot(snapshot)
+          if (fileName) parser.saveFileName = fileName
+          if (fileHandle) parser.fileHandle = fileHandle
+          // File-backed inputs establish what the disk currently holds;
+          // transient buffer reloads (undo/redo) must not, since the file on
+          // disk is unchanged by them
+          if (fileName || fileHandle) parser.markFileSynced(snapshot.rawSaveData)
+        } catch (workerError) {
+          console.warn('Worker parse failed, falling back to in-thread parsing:', workerError)
+          saveData = await parser.parse(input)
+        }
+      } else {
+        // CLI/Node and environments without Worker support
+        saveData = await parser.parse(input)
+      }
+      const parseMetrics = parser.getLastParseMetrics()
+      if (parseMetrics && PokemonSaveParser.isMetricsEnabled) {
+        console.debug('Parse metrics:', parseMetrics)
+      }
       set({
         saveData,
         isLoading: false,
@@ -82,6 +126,8 @@ export const useSaveFileStore = create<SaveFileStore>((set, get) => ({
         lastParseFailed: false,
         parser, // keep the same instance so fileHandle persists
         lastUpdateTransient: transient,
+        parseMetrics,
+        isPreviewData: false,
       })
       // Opening a new file re-enables auto-restore behavior
       if (!transient) {
@@ -92,18 +138,39 @@ export const useSaveFileStore = create<SaveFileStore>((set, get) => ({
       if (!transient) {
         try {
           if (parser.fileHandle) {
-            await addRecent(parser.fileHandle, parser.saveFileName ?? 'Save file')
+            // Persist the party bytes alongside the handle so the next visit
+            // can render the party before re-reading the file
+            let snapshot: RecentPartySnapshot | undefined
+            const configName = parser.gameConfig?.name
+            if (configName) {
+              let lastModified = 0
+              try {
+                lastModified = (await parser.fileHandle.getFile()).lastModified
+              } catch {}
+              snapshot = {
+                configName,
+                playerName: saveData.player_name,
+                playTime: saveData.play_time,
+                partyRaw: saveData.party_pokemon.map(p => p.rawBytes),
+                lastModified,
+                savedAt: Date.now(),
+              }
+            }
+            await addRecent(parser.fileHandle, parser.saveFileName ?? 'Save file', snapshot)
           }
         } catch {}
       }
       return saveData
     } catch (error) {
       const errorMessage = error instanceof Error ? error.message : 'Failed to parse save file'
-      set({
+      set(state => ({
         isLoading: false,
         error: errorMessage,
         lastParseFailed: true,
-      })
+        // A preview party whose backing parse failed may be stale; fall back
+        // to the dropzone rather than leaving it on screen
+        ...(state.isPreviewData ? { saveData: null, hasFile: false, isPreviewData: false } : {}),
+      }))
       throw error
     }
   },
@@ -122,18 +189,62 @@ export const useSaveFileStore = create<SaveFileStore>((set, get) => ({
       // Also bump session to ensure UI clears any derived local state
       saveSessionId: get().saveSessionId + 1,
       lastUpdateTransient: false,
+      isPreviewData: false,
     })
   },
 
+  previewFromSnapshot: async (snapshot: RecentPartySnapshot) => {
+    // Never paint over a file the user already loaded
+    if (get().hasFile) return false
+
+    // Materialize the config the snapshot was taken with; an unknown name
+    // means the registered games changed since it was saved
+    let config: GameConfig | null = null
+    try {
+      config = await GameConfigRegistry.loadByName(snapshot.configName)
+    } catch {
+      return false
+    }
+    if (!config) return false
+    const resolvedConfig = config
+
+    // Re-check after the await: a real parse may have landed in the meantime
+    if (get().hasFile) return false
+
+    let party: PokemonBase[]
+    try {
+      party = snapshot.partyRaw.map(raw => createPokemon(new Uint8Array(raw), resolvedConfig))
+    } catch {
+      // Corrupt or truncated snapshot bytes; skip the preview entirely
+      return false
+    }
+
+    set(state => ({
+      saveData: {
+        party_pokemon: party,
+        player_name: snapshot.playerName,
+        play_time: snapshot.playTime,
+        active_slot: 0,
+      },
+      hasFile: true,
+      isPreviewData: true,
+      lastUpdateTransient: false,
+      saveSessionId: state.saveSessionId + 1,
+    }))
+    return true
+  },
+
+  clearPreview: () => {
+    if (!get().isPreviewData) return
+    get().clearSaveFile()
+  },
+
   reconstructAndDownload: async (method: 'download' | 'saveAs' | 'save' = 'download') => {
     const { saveData, parser } = get()
     if (!saveData || !parser) {
       throw new Error('No save data loaded')
     }
 
-    // Use the same parser instance
-    const newSave = parser.reconstructSaveFile(saveData.party_pokemon)
-    const blob = new Blob([newSave], { type: 'application/octet-stream' })
     const defaultFileName = parser.saveFileName ?? 'pokemon_save.sav'
 
     if (method === 'saveAs') {
@@ -145,6 +256,11 @@ export const useSaveFileStore = create<SaveFileStore>((set, get) => ({
         return
       }
 
+      // The Blob copies the bytes immediately, so the parser's reusable
+      // reconstruction buffer can be handed over as-is
+      const newSave = parser.reconstructSaveFile(saveData.party_pokemon, { reuseBuffer: true })
+      const blob = new Blob([newSave], { type: 'application/octet-stream' })
+
       let handle: FileSystemFileHandle | null = null
       let writable: FileSystemWritableFileStream | null = null
       try {
@@ -159,6 +275,9 @@ export const useSaveFileStore = create<SaveFileStore>((set, get) => ({
         })
         writable = await handle.createWritable()
         await writable.write(blob)
+        // The new file now holds exactly these bytes, so patched saves
+        // against this handle start from a known baseline
+        parser.markFileSynced(newSave)
         // Persist the new handle so subsequent 'Save' is enabled
         parser.fileHandle = handle
         if (typeof handle.name === 'string' && handle.name) {
@@ -192,30 +311,23 @@ export const useSaveFileStore = create<SaveFileStore>((set, get) => ({
         })
         return
       }
-      let writable: FileSystemWritableFileStream | null = null
       try {
-        writable = await parser.fileHandle.createWritable()
-        await writable.write(blob)
+        // Positioned writes rewrite only the sectors that actually changed
+        // since the file was loaded or last saved
+        await parser.writePatched(saveData.party_pokemon)
       } catch (err) {
         const message = err instanceof Error ? err.message : 'Failed to save file'
         toast.error(message, {
           position: 'bottom-center',
           duration: 5000,
         })
-      } finally {
-        if (writable) {
-          try {
-            await writable.close()
-          } catch (closeError) {
-            console.warn('Failed to close writable handle after Save:', closeError)
-          }
-        }
       }
       return
     }
 
     // 'download' method always uses file-saver
-    saveAs(blob, defaultFileName)
+    const newSave = parser.reconstructSaveFile(saveData.party_pokemon, { reuseBuffer: true })
+    saveAs(new Blob([newSave], { type: 'application/octet-stream' }), defaultFileName)
   },
 
   updatePartyOrder: (party: PokemonBase[]) => {
@@ -26,6 +26,32 @@ export default defineConfig({
     VitePWA({
       registerType: 'autoUpdate',
       includeAssets: ['favicon.ico', 'apple-touch-icon.png', 'safari-pinned-tab.svg'],
+      workbox: {
+        runtimeCaching: [
+          {
+            // Long tail of remote sprites not covered by the packed item
+            // sheet (individual item icons, Pokemon box artwork)
+            urlPattern: /^https:\/\/raw\.githubusercontent\.com\/PokeAPI\/sprites\//,
+            handler: 'CacheFirst',
+            options: {
+              cacheName: 'remote-sprites',
+              expiration: { maxEntries: 1500, maxAgeSeconds: 60 * 60 * 24 * 30 },
+              // Opaque responses too: sprites are fetched cross-origin without CORS
+              cacheableResponse: { statuses: [0, 200] },
+            },
+          },
+          {
+            // Same-origin sprite assets (animated party gifs, item sheet);
+            // fetched on demand, so they are runtime-cached instead of precached
+            urlPattern: ({ sameOrigin, url }) => sameOrigin && url.pathname.startsWith('/sprites/'),
+            handler: 'CacheFirst',
+            options: {
+              cacheName: 'local-sprites',
+              expiration: { maxEntries: 2000, maxAgeSeconds: 60 * 60 * 24 * 30 },
+            },
+          },
+        ],
+      },
       manifest: {
         name: 'Pokemon Save Editor',
         short_name: 'PokeSave',
@@ -9,6 +9,9 @@ export default defineConfig({
     include: ['src/**/*.{test,spec}.{js,ts,tsx}', 'scripts/**/*.{test,spec}.{js,ts,tsx}'],
     exclude: ['node_modules', 'dist', 'src/**/*.e2e.test.ts'],
     setupFiles: ['src/__tests__/setup.ts'],
+    benchmark: {
+      include: ['src/**/*.bench.{js,ts,tsx}'],
+    },
   },
   resolve: {
     alias: {
@@ -25,6 +28,9 @@ export default defineConfig({
         include: ['src/**/*.{test,spec}.{js,ts,tsx}'],
         exclude: ['src/**/*.e2e.test.ts'],
         setupFiles: ['src/__tests__/setup.ts'],
+        benchmark: {
+          include: ['src/**/*.bench.{js,ts,tsx}'],
+        },
       },
       resolve: {
         alias: {